@@ -6,6 +6,14 @@
 #define AI_CHOICE_FLEE 4
 #define AI_CHOICE_WATCH 5
 
+struct AICmdProfile
+{
+    u32 count;
+    u32 cycles;
+};
+
+extern struct AICmdProfile gAICmdProfile[];
+
 void BattleAI_HandleItemUseBeforeAISetup(u8 defaultScoreMoves);
 void BattleAI_SetupAIData(u8 defaultScoreMoves);
 u8 BattleAI_ChooseMoveOrAction(void);
@@ -14,5 +22,6 @@ void RecordAbilityBattle(u8 battler, u8 abilityId);
 void ClearBattlerAbilityHistory(u8 battler);
 void RecordItemEffectBattle(u8 battler, u8 itemEffect);
 void ClearBattlerItemEffectHistory(u8 battler);
+void ResetAICmdProfile(void);
 
 #endif // GUARD_BATTLE_AI_SCRIPT_COMMANDS_H
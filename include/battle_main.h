@@ -27,6 +27,13 @@ struct MultiPartnerMenuPokemon
 #define TYPE_EFFECT_DEF_TYPE(i) ((gTypeEffectiveness[i + 1]))
 #define TYPE_EFFECT_MULTIPLIER(i) ((gTypeEffectiveness[i + 2]))
 
+// defines for the u8 arrays gTypeEffectivenessMatrix and gForesightTypeEffectivenessMatrix
+#define TYPE_EFFECTIVENESS(atkType, defType) ((gTypeEffectivenessMatrix[atkType][defType]))
+#define FORESIGHT_TYPE_EFFECTIVENESS(atkType, defType) ((gForesightTypeEffectivenessMatrix[atkType][defType]))
+
+// max number of multipliers returned by GetTypeEffectivenessMultipliers
+#define MAX_TYPE_EFFECTIVENESS_MULTIPLIERS 4
+
 // defines for the gTypeEffectiveness multipliers
 #define TYPE_MUL_NO_EFFECT          0
 #define TYPE_MUL_NOT_EFFECTIVE      5
@@ -76,6 +83,7 @@ void RunBattleScriptCommands_PopCallbacksStack(void);
 void RunBattleScriptCommands(void);
 bool8 TryRunFromBattle(u8 battler);
 void SpecialStatusesClear(void);
+u8 GetTypeEffectivenessMultipliers(u8 atkType, u8 defType1, u8 defType2, bool8 ignoreForesightExceptions, u8 *multipliers);
 
 extern struct MultiPartnerMenuPokemon gMultiPartnerParty[MULTI_PARTY_SIZE];
 
@@ -83,6 +91,9 @@ extern const struct SpriteTemplate gUnusedBattleInitSprite;
 extern const struct OamData gOamData_BattleSpriteOpponentSide;
 extern const struct OamData gOamData_BattleSpritePlayerSide;
 extern const u8 gTypeEffectiveness[336];
+extern const u8 gTypeEffectivenessMatrix[NUMBER_OF_MON_TYPES][NUMBER_OF_MON_TYPES];
+extern const u8 gTypeEffectivenessOrder[NUMBER_OF_MON_TYPES][NUMBER_OF_MON_TYPES];
+extern const u8 gForesightTypeEffectivenessMatrix[NUMBER_OF_MON_TYPES][NUMBER_OF_MON_TYPES];
 extern const u8 gTypeNames[NUMBER_OF_MON_TYPES][TYPE_NAME_LENGTH + 1];
 extern const struct TrainerMoney gTrainerMoneyTable[];
 extern const u8 gAbilityNames[][ABILITY_NAME_LENGTH + 1];
@@ -1,6 +1,8 @@
 #ifndef GUARD_BATTLE_TOWER_H
 #define GUARD_BATTLE_TOWER_H
 
+#include "constants/items.h"
+
 struct RSBattleTowerRecord
 {
     /*0x00*/ u8 lvlMode; // 0 = level 50, 1 = level 100
@@ -33,6 +35,14 @@ struct FacilityMon
     u8 nature;
 };
 
+// The species and held items already on a Frontier party while it's being
+// generated, so candidates can be filtered out before a random pick.
+struct FrontierPartyUsage
+{
+    u32 species[DIV_ROUND_UP(NUM_SPECIES, 32)];
+    u32 heldItems[DIV_ROUND_UP(ITEMS_COUNT, 32)];
+};
+
 extern const u8 gTowerMaleFacilityClasses[30];
 extern const u8 gTowerMaleTrainerGfxIds[30];
 extern const u8 gTowerFemaleFacilityClasses[20];
@@ -62,6 +72,10 @@ void GetFrontierTrainerName(u8 *dst, u16 trainerId);
 void FillFrontierTrainerParty(u8 monsCount);
 void FillFrontierTrainersParties(u8 monsCount);
 u16 GetRandomFrontierMonFromSet(u16 trainerId);
+void ClearFrontierPartyUsage(struct FrontierPartyUsage *usage);
+void AddFrontierPartyUsage(struct FrontierPartyUsage *usage, u16 species, u16 heldItem);
+bool32 IsFrontierPartySpeciesUsed(const struct FrontierPartyUsage *usage, u16 species);
+bool32 IsFrontierPartyHeldItemUsed(const struct FrontierPartyUsage *usage, u16 heldItem);
 void FrontierSpeechToString(const u16 *words);
 void DoSpecialTrainerBattle(void);
 void CalcEmeraldBattleTowerChecksum(struct EmeraldBattleTowerRecord *record);
@@ -44,6 +44,14 @@
 #define CHAR_DEC_SEPARATOR CHAR_COMMA
 #endif
 
+// Uncomment to time each part of every frame and regularly print a summary
+// through the handler above. NDEBUG must be commented out to see the output.
+//#define FRAME_PROFILE
+
+// Uncomment to generate Battle Frontier parties by rerolling random picks until
+// one is allowed, which consumes the RNG exactly like the original games.
+//#define FRONTIER_PARTY_RNG_COMPAT
+
 // Uncomment to fix some identified minor bugs
 //#define BUGFIX
 
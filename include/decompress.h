@@ -5,8 +5,22 @@
 
 extern u8 ALIGNED(4) gDecompressionBuffer[0x4000];
 
+// Progress of an LZ77 decompression that is spread over several calls to LZDecompressContinue.
+struct LZDecompressState
+{
+    const u8 *src;
+    u8 *dest;
+    u8 *end;
+    u8 flags;
+    u8 flagsLeft;
+};
+
 void LZDecompressWram(const u32 *src, void *dest);
 void LZDecompressVram(const u32 *src, void *dest);
+void LZDecompressStart(struct LZDecompressState *state, const u32 *src, void *dest);
+bool8 LZDecompressContinue(struct LZDecompressState *state, u32 maxBytes);
+u8 CreateLZDecompressTask(const u32 *src, void *dest, u16 bytesPerFrame, u8 priority);
+bool8 IsLZDecompressTaskActive(void);
 
 u16 LoadCompressedSpriteSheet(const struct CompressedSpriteSheet *src);
 void LoadCompressedSpriteSheetOverrideBuffer(const struct CompressedSpriteSheet *src, void *buffer);
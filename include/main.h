@@ -56,6 +56,20 @@ extern u8 gLinkVSyncDisabled;
 extern u32 IntrMain_Buffer[];
 extern s8 gPcmDmaCounter;
 
+#ifdef FRAME_PROFILE
+enum {
+    FRAME_PROFILE_CALLBACK1,
+    FRAME_PROFILE_CALLBACK2,
+    FRAME_PROFILE_TASKS,
+    FRAME_PROFILE_ANIMATE_SPRITES,
+    FRAME_PROFILE_BUILD_OAM,
+    FRAME_PROFILE_VBLANK_CALLBACK,
+    FRAME_PROFILE_DMA3_REQUESTS,
+    FRAME_PROFILE_FRAME,
+    FRAME_PROFILE_COUNT
+};
+#endif
+
 void AgbMain(void);
 void SetMainCallback2(MainCallback callback);
 void InitKeys(void);
@@ -68,6 +82,14 @@ void SetTrainerHillVBlankCounter(u32 *counter);
 void ClearTrainerHillVBlankCounter(void);
 void DoSoftReset(void);
 void ClearPokemonCrySongs(void);
+void StartCycleCounter(void);
+void ResumeCycleCounter(void);
+u32 GetCycleCounter(void);
+u32 GetCyclesSince(u32 startCycles);
+#ifdef FRAME_PROFILE
+void FrameProfile_AddCycles(u8 section, u32 startCycles);
+void FrameProfile_AddTaskCycles(void (*func)(u8), u32 startCycles);
+#endif
 void RestoreSerialTimer3IntrHandlers(void);
 void StartTimer1(void);
 void SeedRngAndSetTrainerId(void);
@@ -76,6 +76,9 @@ bool8 FreeTempTileDataBuffersIfPossible(void);
 struct WindowTemplate CreateWindowTemplate(u8 bg, u8 left, u8 top, u8 width, u8 height, u8 paletteNum, u16 baseBlock);
 void CreateYesNoMenu(const struct WindowTemplate *window, u16 baseTileNum, u8 paletteNum, u8 initialCursorPos);
 void DecompressAndLoadBgGfxUsingHeap(u8 bgId, const void *src, u32 size, u16 offset, u8 mode);
+void DecompressAndLoadBgGfxUsingHeapInSteps(u8 bgId, const void *src, u32 size, u16 offset, u8 mode, u16 bytesPerFrame);
+// Only tracks DecompressAndLoadBgGfxUsingHeapInSteps, not DecompressAndLoadBgGfxUsingHeap
+bool8 IsDecompressingBgGfxUsingHeap(void);
 s8 Menu_ProcessInputNoWrapClearOnChoose(void);
 s8 ProcessMenuInput_other(void);
 void DoScheduledBgTilemapCopiesToVram(void);
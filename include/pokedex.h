@@ -18,6 +18,8 @@ enum
     FLAG_SET_CAUGHT
 };
 
+#define NUM_DEX_FLAG_WORDS (NUM_DEX_FLAG_BYTES / 4)
+
 struct PokedexEntry
 {
     /*0x00*/ u8 categoryName[12];
@@ -37,6 +39,7 @@ u16 GetNationalPokedexCount(u8 caseID);
 u16 GetHoennPokedexCount(u8 caseID);
 u8 DisplayCaughtMonDexPage(u16 dexNum, u32 otId, u32 personality);
 s8 GetSetPokedexFlag(u16 nationalDexNo, u8 caseID);
+void GetPokedexFlagWords(u32 *seen, u32 *caught);
 u16 CreateMonSpriteFromNationalDexNumber(u16 nationalNum, s16 x, s16 y, u16 paletteSlot);
 bool16 HasAllHoennMons(void);
 void ResetPokedexScrollPositions(void);
@@ -4,6 +4,7 @@
 extern u32 gRecordedBattleRngSeed;
 extern u32 gBattlePalaceMoveSelectionRngValue;
 extern u8 gRecordedBattleMultiplayerId;
+extern u32 gRecordedBattlePlaybackFrames;
 
 #define B_RECORD_MODE_RECORDING 1
 #define B_RECORD_MODE_PLAYBACK 2
@@ -18,6 +19,9 @@ void RecordedBattle_RecordAllBattlerData(u8 *src);
 bool32 CanCopyRecordedBattleSaveData(void);
 bool32 MoveRecordedBattleToSaveData(void);
 void PlayRecordedBattle(void (*CB2_After)(void));
+void RecordedBattle_SetHeadlessPlayback(bool8 headless);
+bool8 RecordedBattle_IsHeadlessPlayback(void);
+bool32 RecordedBattle_SkipControllerCmd(u8 cmd);
 u8 GetRecordedBattleFrontierFacility(void);
 u8 GetRecordedBattleFronterBrainSymbol(void);
 void RecordedBattle_SaveParties(void);
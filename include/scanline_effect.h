@@ -14,6 +14,15 @@
 #define SCANLINE_EFFECT_REG_BG3HOFS (REG_ADDR_BG3HOFS - REG_ADDR_BG0HOFS)
 #define SCANLINE_EFFECT_REG_BG3VOFS (REG_ADDR_BG3VOFS - REG_ADDR_BG0HOFS)
 
+// HBlank callbacks for ScanlineEffect_GetHBlankCallback
+enum {
+    SCANLINE_HBLANK_BG123_HOFS,
+    SCANLINE_HBLANK_BG123_HOFS_VISIBLE, // Only during the visible scanlines
+    SCANLINE_HBLANK_BG123_VOFS,
+    SCANLINE_HBLANK_BG0_VOFS,
+    SCANLINE_HBLANK_BLDY,
+};
+
 struct ScanlineEffectParams
 {
     volatile void *dmaDest;
@@ -43,6 +52,7 @@ void ScanlineEffect_Stop(void);
 void ScanlineEffect_Clear(void);
 void ScanlineEffect_SetParams(struct ScanlineEffectParams params);
 void ScanlineEffect_InitHBlankDmaTransfer(void);
+void (*ScanlineEffect_GetHBlankCallback(u8 id))(void);
 u8 ScanlineEffect_InitWave(u8 startLine, u8 endLine, u8 frequency, u8 amplitude, u8 delayInterval, u8 regOffset, bool8 applyBattleBgOffsets);
 
 #endif // GUARD_SCANLINE_EFFECT_H
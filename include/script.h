@@ -19,13 +19,22 @@ struct ScriptContext
     u32 data[4];
 };
 
+struct ScriptCmdProfile
+{
+    u32 count;
+    u32 cycles;
+};
+
 #define ScriptReadByte(ctx) (*(ctx->scriptPtr++))
 
+extern struct ScriptCmdProfile gScriptCmdProfile[];
+
 void InitScriptContext(struct ScriptContext *ctx, void *cmdTable, void *cmdTableEnd);
 u8 SetupBytecodeScript(struct ScriptContext *ctx, const u8 *ptr);
 void SetupNativeScript(struct ScriptContext *ctx, bool8 (*ptr)(void));
 void StopScript(struct ScriptContext *ctx);
 bool8 RunScriptCommand(struct ScriptContext *ctx);
+void ResetScriptCmdProfile(void);
 void ScriptJump(struct ScriptContext *ctx, const u8 *ptr);
 void ScriptCall(struct ScriptContext *ctx, const u8 *ptr);
 void ScriptReturn(struct ScriptContext *ctx);
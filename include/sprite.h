@@ -187,6 +187,14 @@ struct SpriteTemplate
     SpriteCallback callback;
 };
 
+struct SpriteTileAllocStats
+{
+    u16 freeTiles;      // Unreserved OBJ tiles that aren't allocated
+    u16 largestFreeRun; // The most tiles AllocSpriteTiles could currently allocate
+    u16 numFreeRuns;
+    u8 fragmentation;   // Percentage of free tiles outside the largest run
+};
+
 // UB: template pointer is often used to point to temporary storage,
 // then later dereferenced after being freed. Usually this won't
 // be visible in-game, but this is (part of) what causes the item
@@ -315,6 +323,7 @@ bool8 AddSubspritesToOamBuffer(struct Sprite *sprite, struct OamData *destOam, u
 void CopyToSprites(u8 *src);
 void CopyFromSprites(u8 *dest);
 u8 SpriteTileAllocBitmapOp(u16 bit, u8 op);
+void GetSpriteTileAllocStats(struct SpriteTileAllocStats *stats);
 void ClearSpriteCopyRequests(void);
 void ResetAffineAnimData(void);
 
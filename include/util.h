@@ -13,6 +13,7 @@ int CountTrailingZeroBits(u32 value);
 u16 CalcCRC16(const u8 *data, s32 length);
 u16 CalcCRC16WithTable(const u8 *data, u32 length);
 u32 CalcByteArraySum(const u8 *data, u32 length);
+void BlendColors(const u16 *src, u16 *dest, u16 numColors, u8 coeff, u16 blendColor);
 void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u16 blendColor);
 void DoBgAffineSet(struct BgAffineDstData *dest, u32 texX, u32 texY, s16 scrX, s16 scrY, s16 sx, s16 sy, u16 alpha);
 void CopySpriteTiles(u8 shape, u8 size, u8 *tiles, u16 *tilemap, u8 *output);
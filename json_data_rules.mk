@@ -26,3 +26,9 @@ $(C_BUILDDIR)/heal_location.o: c_dep += $(DATA_SRC_SUBDIR)/heal_locations.h
 AUTO_GEN_TARGETS += include/constants/heal_locations.h
 include/constants/heal_locations.h: $(DATA_SRC_SUBDIR)/heal_locations.json $(DATA_SRC_SUBDIR)/heal_locations.constants.json.txt
 	$(JSONPROC) $^ $@
+
+AUTO_GEN_TARGETS += $(DATA_SRC_SUBDIR)/type_effectiveness.h
+$(DATA_SRC_SUBDIR)/type_effectiveness.h: $(DATA_SRC_SUBDIR)/type_effectiveness.json $(DATA_SRC_SUBDIR)/type_effectiveness.json.txt
+	$(JSONPROC) $^ $@
+
+$(C_BUILDDIR)/battle_main.o: c_dep += $(DATA_SRC_SUBDIR)/type_effectiveness.h
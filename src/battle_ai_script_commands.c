@@ -6,6 +6,7 @@
 #include "battle_setup.h"
 #include "data.h"
 #include "item.h"
+#include "main.h"
 #include "pokemon.h"
 #include "random.h"
 #include "recorded_battle.h"
@@ -24,6 +25,10 @@
 #define AI_THINKING_STRUCT ((struct AI_ThinkingStruct *)(gBattleResources->ai))
 #define BATTLE_HISTORY ((struct BattleHistory *)(gBattleResources->battleHistory))
 
+// When this is TRUE, every AI command run counts towards gAICmdProfile, which
+// can be read from a debugger.
+#define PROFILE_AI_CMDS FALSE
+
 // AI states
 enum
 {
@@ -46,6 +51,7 @@ extern const u8 *const gBattleAI_ScriptsTable[];
 static u8 ChooseMoveOrAction_Singles(void);
 static u8 ChooseMoveOrAction_Doubles(void);
 static void RecordLastUsedMoveByTarget(void);
+static void AI_CalcMoveDamage(u8 movesetIndex);
 static void BattleAI_DoAIProcessing(void);
 static void AIStackPushVar(const u8 *);
 static bool8 AIStackPop(void);
@@ -154,6 +160,16 @@ static void Cmd_if_holds_item(void);
 EWRAM_DATA const u8 *gAIScriptPtr = NULL;
 EWRAM_DATA static u8 sBattler_AI = 0;
 
+// The damage AI_CalcMoveDamage worked out for each of sBattler_AI's moves against
+// each target, and a bit per entry for whether it's been worked out yet. Cleared at
+// the start of each BattleAI_ChooseMoveOrAction.
+EWRAM_DATA static s32 sAIMoveDamage[MAX_BATTLERS_COUNT][MAX_MON_MOVES] = {0};
+EWRAM_DATA static u16 sAIMoveDamageCalculated = 0;
+
+#if PROFILE_AI_CMDS
+EWRAM_DATA struct AICmdProfile gAICmdProfile[0x100] = {0};
+#endif
+
 // const rom data
 typedef void (*BattleAICmdFunc)(void);
 
@@ -384,6 +400,7 @@ u8 BattleAI_ChooseMoveOrAction(void)
     u16 savedCurrentMove = gCurrentMove;
     u8 ret;
 
+    sAIMoveDamageCalculated = 0;
     if (!(gBattleTypeFlags & BATTLE_TYPE_DOUBLE))
         ret = ChooseMoveOrAction_Singles();
     else
@@ -569,6 +586,27 @@ static u8 ChooseMoveOrAction_Doubles(void)
     return actionOrMoveIndex[gBattlerTarget];
 }
 
+void ResetAICmdProfile(void)
+{
+#if PROFILE_AI_CMDS
+    CpuFill32(0, gAICmdProfile, sizeof(gAICmdProfile));
+#endif
+}
+
+#if PROFILE_AI_CMDS
+static void RunProfiledAICommand(u8 cmdCode)
+{
+    u32 start;
+
+    ResumeCycleCounter();
+    start = GetCycleCounter();
+
+    sBattleAICmdTable[cmdCode]();
+    gAICmdProfile[cmdCode].cycles += GetCyclesSince(start);
+    gAICmdProfile[cmdCode].count++;
+}
+#endif
+
 static void BattleAI_DoAIProcessing(void)
 {
     while (AI_THINKING_STRUCT->aiState != AIState_FinishedProcessing)
@@ -592,7 +630,11 @@ static void BattleAI_DoAIProcessing(void)
             case AIState_Processing:
                 if (AI_THINKING_STRUCT->moveConsidered != 0)
                 {
+#if PROFILE_AI_CMDS
+                    RunProfiledAICommand(*gAIScriptPtr);
+#else
                     sBattleAICmdTable[*gAIScriptPtr](); // Run AI command.
+#endif
                 }
                 else
                 {
@@ -1171,6 +1213,26 @@ static void Cmd_get_considered_move_power(void)
     gAIScriptPtr += 1;
 }
 
+// Sets gBattleMoveDamage to the damage sBattler_AI's move in the given slot (gCurrentMove)
+// would do to gBattlerTarget, before the simulated damage roll. Callers reset the damage
+// modifiers first, and nothing the AI looks at changes while it chooses a move, so the
+// result is saved and reused until the next BattleAI_ChooseMoveOrAction.
+static void AI_CalcMoveDamage(u8 movesetIndex)
+{
+    u16 bit = 1 << (gBattlerTarget * MAX_MON_MOVES + movesetIndex);
+
+    if (sAIMoveDamageCalculated & bit)
+    {
+        gBattleMoveDamage = sAIMoveDamage[gBattlerTarget][movesetIndex];
+        return;
+    }
+
+    AI_CalcDmg(sBattler_AI, gBattlerTarget);
+    TypeCalc(gCurrentMove, sBattler_AI, gBattlerTarget);
+    sAIMoveDamage[gBattlerTarget][movesetIndex] = gBattleMoveDamage;
+    sAIMoveDamageCalculated |= bit;
+}
+
 static void Cmd_get_how_powerful_move_is(void)
 {
     s32 i, checkedMove;
@@ -1206,8 +1268,7 @@ static void Cmd_get_how_powerful_move_is(void)
                 && gBattleMoves[gBattleMons[sBattler_AI].moves[checkedMove]].power > 1)
             {
                 gCurrentMove = gBattleMons[sBattler_AI].moves[checkedMove];
-                AI_CalcDmg(sBattler_AI, gBattlerTarget);
-                TypeCalc(gCurrentMove, sBattler_AI, gBattlerTarget);
+                AI_CalcMoveDamage(checkedMove);
                 moveDmgs[checkedMove] = gBattleMoveDamage * AI_THINKING_STRUCT->simulatedRNG[checkedMove] / 100;
                 if (moveDmgs[checkedMove] == 0)
                     moveDmgs[checkedMove] = 1;
@@ -1745,8 +1806,7 @@ static void Cmd_if_can_faint(void)
     gMoveResultFlags = 0;
     gCritMultiplier = 1;
     gCurrentMove = AI_THINKING_STRUCT->moveConsidered;
-    AI_CalcDmg(sBattler_AI, gBattlerTarget);
-    TypeCalc(gCurrentMove, sBattler_AI, gBattlerTarget);
+    AI_CalcMoveDamage(AI_THINKING_STRUCT->movesetIndex);
 
     gBattleMoveDamage = gBattleMoveDamage * AI_THINKING_STRUCT->simulatedRNG[AI_THINKING_STRUCT->movesetIndex] / 100;
 
@@ -1774,8 +1834,7 @@ static void Cmd_if_cant_faint(void)
     gMoveResultFlags = 0;
     gCritMultiplier = 1;
     gCurrentMove = AI_THINKING_STRUCT->moveConsidered;
-    AI_CalcDmg(sBattler_AI, gBattlerTarget);
-    TypeCalc(gCurrentMove, sBattler_AI, gBattlerTarget);
+    AI_CalcMoveDamage(AI_THINKING_STRUCT->movesetIndex);
 
     gBattleMoveDamage = gBattleMoveDamage * AI_THINKING_STRUCT->simulatedRNG[AI_THINKING_STRUCT->movesetIndex] / 100;
 
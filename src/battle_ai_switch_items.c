@@ -604,26 +604,12 @@ void AI_TrySwitchOrUseItem(void)
 
 static void ModulateByTypeEffectiveness(u8 atkType, u8 defType1, u8 defType2, u8 *var)
 {
-    s32 i = 0;
+    s32 i, count;
+    u8 multipliers[MAX_TYPE_EFFECTIVENESS_MULTIPLIERS];
 
-    while (TYPE_EFFECT_ATK_TYPE(i) != TYPE_ENDTABLE)
-    {
-        if (TYPE_EFFECT_ATK_TYPE(i) == TYPE_FORESIGHT)
-        {
-            i += 3;
-            continue;
-        }
-        else if (TYPE_EFFECT_ATK_TYPE(i) == atkType)
-        {
-            // Check type1.
-            if (TYPE_EFFECT_DEF_TYPE(i) == defType1)
-                *var = (*var * TYPE_EFFECT_MULTIPLIER(i)) / TYPE_MUL_NORMAL;
-            // Check type2.
-            if (TYPE_EFFECT_DEF_TYPE(i) == defType2 && defType1 != defType2)
-                *var = (*var * TYPE_EFFECT_MULTIPLIER(i)) / TYPE_MUL_NORMAL;
-        }
-        i += 3;
-    }
+    count = GetTypeEffectivenessMultipliers(atkType, defType1, defType2, FALSE, multipliers);
+    for (i = 0; i < count; i++)
+        *var = (*var * multipliers[i]) / TYPE_MUL_NORMAL;
 }
 
 u8 GetMostSuitableMonToSwitchInto(void)
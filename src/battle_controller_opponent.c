@@ -20,6 +20,7 @@
 #include "pokeball.h"
 #include "pokemon.h"
 #include "random.h"
+#include "recorded_battle.h"
 #include "reshow_battle_screen.h"
 #include "sound.h"
 #include "string_util.h"
@@ -181,7 +182,9 @@ static void OpponentBufferRunCommand(void)
 {
     if (gBattleControllerExecFlags & gBitTable[gActiveBattler])
     {
-        if (gBattleBufferA[gActiveBattler][0] < ARRAY_COUNT(sOpponentBufferCommands))
+        if (RecordedBattle_SkipControllerCmd(gBattleBufferA[gActiveBattler][0]))
+            OpponentBufferExecCompleted();
+        else if (gBattleBufferA[gActiveBattler][0] < ARRAY_COUNT(sOpponentBufferCommands))
             sOpponentBufferCommands[gBattleBufferA[gActiveBattler][0]]();
         else
             OpponentBufferExecCompleted();
@@ -1527,8 +1530,15 @@ static void OpponentHandlePrintString(void)
     gBattle_BG0_Y = 0;
     stringId = (u16 *)(&gBattleBufferA[gActiveBattler][2]);
     BufferStringBattle(*stringId);
-    BattlePutTextOnWindow(gDisplayedStringBattle, B_WIN_MSG);
-    gBattlerControllerFuncs[gActiveBattler] = CompleteOnInactiveTextPrinter;
+    if (RecordedBattle_IsHeadlessPlayback())
+    {
+        OpponentBufferExecCompleted();
+    }
+    else
+    {
+        BattlePutTextOnWindow(gDisplayedStringBattle, B_WIN_MSG);
+        gBattlerControllerFuncs[gActiveBattler] = CompleteOnInactiveTextPrinter;
+    }
     BattleArena_DeductSkillPoints(gActiveBattler, *stringId);
 }
 
@@ -173,7 +173,9 @@ static void RecordedOpponentBufferRunCommand(void)
 {
     if (gBattleControllerExecFlags & gBitTable[gActiveBattler])
     {
-        if (gBattleBufferA[gActiveBattler][0] < ARRAY_COUNT(sRecordedOpponentBufferCommands))
+        if (RecordedBattle_SkipControllerCmd(gBattleBufferA[gActiveBattler][0]))
+            RecordedOpponentBufferExecCompleted();
+        else if (gBattleBufferA[gActiveBattler][0] < ARRAY_COUNT(sRecordedOpponentBufferCommands))
             sRecordedOpponentBufferCommands[gBattleBufferA[gActiveBattler][0]]();
         else
             RecordedOpponentBufferExecCompleted();
@@ -1391,8 +1393,15 @@ static void RecordedOpponentHandlePrintString(void)
     gBattle_BG0_Y = 0;
     stringId = (u16 *)(&gBattleBufferA[gActiveBattler][2]);
     BufferStringBattle(*stringId);
-    BattlePutTextOnWindow(gDisplayedStringBattle, B_WIN_MSG);
-    gBattlerControllerFuncs[gActiveBattler] = CompleteOnInactiveTextPrinter;
+    if (RecordedBattle_IsHeadlessPlayback())
+    {
+        RecordedOpponentBufferExecCompleted();
+    }
+    else
+    {
+        BattlePutTextOnWindow(gDisplayedStringBattle, B_WIN_MSG);
+        gBattlerControllerFuncs[gActiveBattler] = CompleteOnInactiveTextPrinter;
+    }
 }
 
 static void RecordedOpponentHandlePrintSelectionString(void)
@@ -168,7 +168,9 @@ static void RecordedPlayerBufferRunCommand(void)
 {
     if (gBattleControllerExecFlags & gBitTable[gActiveBattler])
     {
-        if (gBattleBufferA[gActiveBattler][0] < ARRAY_COUNT(sRecordedPlayerBufferCommands))
+        if (RecordedBattle_SkipControllerCmd(gBattleBufferA[gActiveBattler][0]))
+            RecordedPlayerBufferExecCompleted();
+        else if (gBattleBufferA[gActiveBattler][0] < ARRAY_COUNT(sRecordedPlayerBufferCommands))
             sRecordedPlayerBufferCommands[gBattleBufferA[gActiveBattler][0]]();
         else
             RecordedPlayerBufferExecCompleted();
@@ -1401,8 +1403,15 @@ static void RecordedPlayerHandlePrintString(void)
     gBattle_BG0_Y = 0;
     stringId = (u16 *)(&gBattleBufferA[gActiveBattler][2]);
     BufferStringBattle(*stringId);
-    BattlePutTextOnWindow(gDisplayedStringBattle, B_WIN_MSG);
-    gBattlerControllerFuncs[gActiveBattler] = CompleteOnInactiveTextPrinter;
+    if (RecordedBattle_IsHeadlessPlayback())
+    {
+        RecordedPlayerBufferExecCompleted();
+    }
+    else
+    {
+        BattlePutTextOnWindow(gDisplayedStringBattle, B_WIN_MSG);
+        gBattlerControllerFuncs[gActiveBattler] = CompleteOnInactiveTextPrinter;
+    }
 }
 
 static void RecordedPlayerHandlePrintSelectionString(void)
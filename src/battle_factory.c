@@ -19,6 +19,19 @@
 #include "constants/moves.h"
 #include "constants/items.h"
 
+#ifndef FRONTIER_PARTY_RNG_COMPAT
+// What a Pokémon needs to avoid to join a Factory party that's being generated.
+struct FactoryPartyFilter
+{
+    struct FrontierPartyUsage usage;
+    struct FrontierPartyUsage bannedSpecies;
+    u16 bannedMonIds[PARTY_SIZE + FRONTIER_PARTY_SIZE];
+    u8 numBannedMonIds;
+    bool8 canRepeatSpecies; // One species may appear twice, as two different Pokémon.
+    u16 maxMonId;
+};
+#endif
+
 static bool8 sPerformedRentalSwap;
 
 static void InitFactoryChallenge(void);
@@ -38,7 +51,16 @@ static void GenerateInitialRentalMons(void);
 static void GetOpponentMostCommonMonType(void);
 static void GetOpponentBattleStyle(void);
 static void RestorePlayerPartyHeldItems(void);
+#ifdef FRONTIER_PARTY_RNG_COMPAT
 static u16 GetFactoryMonId(u8 lvlMode, u8 challengeNum, bool8 useBetterRange);
+#endif
+static void CreateFactoryBrainMon(struct Pokemon *mon, u16 monId, u8 level, u8 fixedIV, u32 otId);
+static const u16 *GetFactoryMonIdRange(u8 lvlMode, u8 challengeNum, bool8 useBetterRange);
+#ifndef FRONTIER_PARTY_RNG_COMPAT
+static void InitFactoryPartyFilter(struct FactoryPartyFilter *filter, u16 maxMonId, bool8 canRepeatSpecies);
+static void AddFactoryPartyFilterMon(struct FactoryPartyFilter *filter, u16 monId);
+static s32 ChooseFactoryMon(const u16 *range, const struct FactoryPartyFilter *filter);
+#endif
 static u8 GetMoveBattleStyle(u16 move);
 
 // Number of moves needed on the team to be considered using a certain battle style
@@ -302,10 +324,16 @@ static void SetPerformedRentalSwap(void)
 
 static void GenerateOpponentMons(void)
 {
-    int i, j, k;
+    int i, j;
+#ifdef FRONTIER_PARTY_RNG_COMPAT
+    int k;
     u16 species[FRONTIER_PARTY_SIZE];
     u16 heldItems[FRONTIER_PARTY_SIZE];
     int firstMonId = 0;
+#else
+    struct FactoryPartyFilter filter;
+    const u16 *range;
+#endif
     u16 trainerId = 0;
     u32 lvlMode = gSaveBlock2Ptr->frontier.lvlMode;
     u32 battleMode = VarGet(VAR_FRONTIER_BATTLE_MODE);
@@ -328,6 +356,7 @@ static void GenerateOpponentMons(void)
     if (gSaveBlock2Ptr->frontier.curChallengeBattleNum < FRONTIER_STAGES_PER_CHALLENGE - 1)
         gSaveBlock2Ptr->frontier.trainerIds[gSaveBlock2Ptr->frontier.curChallengeBattleNum] = trainerId;
 
+#ifdef FRONTIER_PARTY_RNG_COMPAT
     i = 0;
     while (i != FRONTIER_PARTY_SIZE)
     {
@@ -374,6 +403,25 @@ static void GenerateOpponentMons(void)
         gFrontierTempParty[i] = monId;
         i++;
     }
+#else
+    // "High tier" Pokémon are only allowed on open level mode
+    InitFactoryPartyFilter(&filter, (lvlMode == FRONTIER_LVL_50) ? FRONTIER_MONS_HIGH_TIER : 0xFFFF, FALSE);
+
+    // None of the opponent's Pokémon may be the same species as the potential rental Pokémon for the player
+    for (j = 0; j < (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons); j++)
+        AddFrontierPartyUsage(&filter.bannedSpecies, gFacilityTrainerMons[gSaveBlock2Ptr->frontier.rentalMons[j].monId].species, ITEM_NONE);
+
+    range = GetFactoryMonIdRange(lvlMode, challengeNum, FALSE);
+    for (i = 0; i < FRONTIER_PARTY_SIZE; i++)
+    {
+        s32 monId = ChooseFactoryMon(range, &filter);
+        if (monId < 0)
+            break;
+
+        AddFactoryPartyFilterMon(&filter, monId);
+        gFrontierTempParty[i] = monId;
+    }
+#endif
 }
 
 static void SetOpponentGfxVar(void)
@@ -508,27 +556,34 @@ static void SetPlayerAndOpponentParties(void)
 
 static void GenerateInitialRentalMons(void)
 {
-    int i, j;
-    u8 firstMonId;
+    int i;
     u8 battleMode;
     u8 lvlMode;
     u8 challengeNum;
     u8 factoryLvlMode;
     u8 factoryBattleMode;
     u8 rentalRank;
+#ifdef FRONTIER_PARTY_RNG_COMPAT
+    u8 firstMonId;
+    int j;
     u16 monId;
     u16 currSpecies;
     u16 species[PARTY_SIZE];
     u16 monIds[PARTY_SIZE];
     u16 heldItems[PARTY_SIZE];
+#else
+    struct FactoryPartyFilter filter;
+#endif
 
     gFacilityTrainers = gBattleFrontierTrainers;
+#ifdef FRONTIER_PARTY_RNG_COMPAT
     for (i = 0; i < PARTY_SIZE; i++)
     {
         species[i] = SPECIES_NONE;
         monIds[i] = 0;
         heldItems[i] = ITEM_NONE;
     }
+#endif
     lvlMode = gSaveBlock2Ptr->frontier.lvlMode;
     battleMode = VarGet(VAR_FRONTIER_BATTLE_MODE);
     challengeNum = gSaveBlock2Ptr->frontier.factoryWinStreaks[battleMode][lvlMode] / FRONTIER_STAGES_PER_CHALLENGE;
@@ -539,17 +594,13 @@ static void GenerateInitialRentalMons(void)
 
     gFacilityTrainerMons = gBattleFrontierMons;
     if (gSaveBlock2Ptr->frontier.lvlMode != FRONTIER_LVL_50)
-    {
         factoryLvlMode = FRONTIER_LVL_OPEN;
-        firstMonId = 0;
-    }
     else
-    {
         factoryLvlMode = FRONTIER_LVL_50;
-        firstMonId = 0;
-    }
     rentalRank = GetNumPastRentalsRank(factoryBattleMode, factoryLvlMode);
 
+#ifdef FRONTIER_PARTY_RNG_COMPAT
+    firstMonId = 0;
     currSpecies = SPECIES_NONE;
     i = 0;
     while (i != PARTY_SIZE)
@@ -598,6 +649,22 @@ static void GenerateInitialRentalMons(void)
         monIds[i] = monId;
         i++;
     }
+#else
+    // Rentals can't repeat held items, but one species may appear twice.
+    InitFactoryPartyFilter(&filter, 0xFFFF, TRUE);
+    for (i = 0; i < PARTY_SIZE; i++)
+    {
+        s32 monId;
+
+        // The more times the player has rented, the more initial rentals are generated from a better set of Pokémon
+        monId = ChooseFactoryMon(GetFactoryMonIdRange(factoryLvlMode, challengeNum, i < rentalRank), &filter);
+        if (monId < 0)
+            break;
+
+        AddFactoryPartyFilterMon(&filter, monId);
+        gSaveBlock2Ptr->frontier.rentalMons[i].monId = monId;
+    }
+#endif
 }
 
 // Determines if the upcoming opponent has a single most-common
@@ -758,10 +825,15 @@ u8 GetFactoryMonFixedIV(u8 challengeNum, bool8 isLastBattle)
 
 void FillFactoryBrainParty(void)
 {
-    int i, j, k;
+    int i, j;
+#ifdef FRONTIER_PARTY_RNG_COMPAT
+    int k;
     u16 species[FRONTIER_PARTY_SIZE];
     u16 heldItems[FRONTIER_PARTY_SIZE];
-    u8 friendship;
+#else
+    struct FactoryPartyFilter filter;
+    const u16 *range;
+#endif
     int monLevel;
     u8 fixedIV;
     u32 otId;
@@ -771,9 +843,10 @@ void FillFactoryBrainParty(void)
     u8 challengeNum = gSaveBlock2Ptr->frontier.factoryWinStreaks[battleMode][lvlMode] / FRONTIER_STAGES_PER_CHALLENGE;
     fixedIV = GetFactoryMonFixedIV(challengeNum + 2, FALSE);
     monLevel = SetFacilityPtrsGetLevel();
-    i = 0;
     otId = T1_READ_32(gSaveBlock2Ptr->playerTrainerId);
 
+#ifdef FRONTIER_PARTY_RNG_COMPAT
+    i = 0;
     while (i != FRONTIER_PARTY_SIZE)
     {
         u16 monId = GetFactoryMonId(lvlMode, challengeNum, FALSE);
@@ -809,26 +882,66 @@ void FillFactoryBrainParty(void)
 
         species[i] = gFacilityTrainerMons[monId].species;
         heldItems[i] = gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId];
-        CreateMonWithEVSpreadNatureOTID(&gEnemyParty[i],
-                                             gFacilityTrainerMons[monId].species,
-                                             monLevel,
-                                             gFacilityTrainerMons[monId].nature,
-                                             fixedIV,
-                                             gFacilityTrainerMons[monId].evSpread,
-                                             otId);
-
-        friendship = 0;
-        for (k = 0; k < MAX_MON_MOVES; k++)
-            SetMonMoveAvoidReturn(&gEnemyParty[i], gFacilityTrainerMons[monId].moves[k], k);
-        SetMonData(&gEnemyParty[i], MON_DATA_FRIENDSHIP, &friendship);
-        SetMonData(&gEnemyParty[i], MON_DATA_HELD_ITEM, &gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
+        CreateFactoryBrainMon(&gEnemyParty[i], monId, monLevel, fixedIV, otId);
         i++;
     }
+#else
+    InitFactoryPartyFilter(&filter, (monLevel == FRONTIER_MAX_LEVEL_50) ? FRONTIER_MONS_HIGH_TIER : 0xFFFF, FALSE);
+
+    // The Factory Head's Pokémon can't be any of the rental Pokémon.
+    for (j = 0; j < (int)ARRAY_COUNT(gSaveBlock2Ptr->frontier.rentalMons); j++)
+        filter.bannedMonIds[filter.numBannedMonIds++] = gSaveBlock2Ptr->frontier.rentalMons[j].monId;
+
+    range = GetFactoryMonIdRange(lvlMode, challengeNum, FALSE);
+    for (i = 0; i < FRONTIER_PARTY_SIZE; i++)
+    {
+        s32 monId = ChooseFactoryMon(range, &filter);
+        if (monId < 0)
+            break;
+
+        AddFactoryPartyFilterMon(&filter, monId);
+        CreateFactoryBrainMon(&gEnemyParty[i], monId, monLevel, fixedIV, otId);
+    }
+#endif
+}
+
+static void CreateFactoryBrainMon(struct Pokemon *mon, u16 monId, u8 level, u8 fixedIV, u32 otId)
+{
+    int i;
+    u8 friendship;
+
+    CreateMonWithEVSpreadNatureOTID(mon,
+                                         gFacilityTrainerMons[monId].species,
+                                         level,
+                                         gFacilityTrainerMons[monId].nature,
+                                         fixedIV,
+                                         gFacilityTrainerMons[monId].evSpread,
+                                         otId);
+
+    friendship = 0;
+    for (i = 0; i < MAX_MON_MOVES; i++)
+        SetMonMoveAvoidReturn(mon, gFacilityTrainerMons[monId].moves[i], i);
+    SetMonData(mon, MON_DATA_FRIENDSHIP, &friendship);
+    SetMonData(mon, MON_DATA_HELD_ITEM, &gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
 }
 
+#ifdef FRONTIER_PARTY_RNG_COMPAT
 static u16 GetFactoryMonId(u8 lvlMode, u8 challengeNum, bool8 useBetterRange)
 {
     u16 numMons, monId;
+    const u16 *range = GetFactoryMonIdRange(lvlMode, challengeNum, useBetterRange);
+
+    numMons = (range[1] - range[0]) + 1;
+    monId = Random() % numMons;
+    monId += range[0];
+
+    return monId;
+}
+#endif
+
+// Returns the first and last monId that GetFactoryMonId can choose from.
+static const u16 *GetFactoryMonIdRange(u8 lvlMode, u8 challengeNum, bool8 useBetterRange)
+{
     u16 adder; // Used to skip past early mons for open level
 
     if (lvlMode == FRONTIER_LVL_50)
@@ -839,31 +952,84 @@ static u16 GetFactoryMonId(u8 lvlMode, u8 challengeNum, bool8 useBetterRange)
     if (challengeNum < 7)
     {
         if (useBetterRange)
-        {
-            numMons = (sInitialRentalMonRanges[adder + challengeNum + 1][1] - sInitialRentalMonRanges[adder + challengeNum + 1][0]) + 1;
-            monId = Random() % numMons;
-            monId += sInitialRentalMonRanges[adder + challengeNum + 1][0];
-        }
+            return sInitialRentalMonRanges[adder + challengeNum + 1];
         else
-        {
-            numMons = (sInitialRentalMonRanges[adder + challengeNum][1] - sInitialRentalMonRanges[adder + challengeNum][0]) + 1;
-            monId = Random() % numMons;
-            monId += sInitialRentalMonRanges[adder + challengeNum][0];
-        }
+            return sInitialRentalMonRanges[adder + challengeNum];
     }
     else
     {
-        u16 challenge = challengeNum;
-        if (challenge != 7)
-            challenge = 7; // why bother assigning it above at all
+        return sInitialRentalMonRanges[adder + 7];
+    }
+}
+
+#ifndef FRONTIER_PARTY_RNG_COMPAT
+static void InitFactoryPartyFilter(struct FactoryPartyFilter *filter, u16 maxMonId, bool8 canRepeatSpecies)
+{
+    ClearFrontierPartyUsage(&filter->usage);
+    ClearFrontierPartyUsage(&filter->bannedSpecies);
+    filter->numBannedMonIds = 0;
+    filter->canRepeatSpecies = canRepeatSpecies;
+    filter->maxMonId = maxMonId;
+}
+
+static void AddFactoryPartyFilterMon(struct FactoryPartyFilter *filter, u16 monId)
+{
+    u16 species = gFacilityTrainerMons[monId].species;
+
+    if (IsFrontierPartySpeciesUsed(&filter->usage, species))
+        filter->canRepeatSpecies = FALSE;
+    AddFrontierPartyUsage(&filter->usage, species, gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
+    filter->bannedMonIds[filter->numBannedMonIds++] = monId;
+}
+
+static bool32 IsFactoryMonAllowed(u16 monId, const struct FactoryPartyFilter *filter)
+{
+    s32 i;
+    u16 species = gFacilityTrainerMons[monId].species;
+
+    // Unown (FRONTIER_MON_UNOWN) is forbidden on Factory teams.
+    if (species == SPECIES_UNOWN || monId > filter->maxMonId)
+        return FALSE;
+    if (IsFrontierPartySpeciesUsed(&filter->bannedSpecies, species))
+        return FALSE;
+    if (IsFrontierPartyHeldItemUsed(&filter->usage, gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]))
+        return FALSE;
+    if (IsFrontierPartySpeciesUsed(&filter->usage, species) && !filter->canRepeatSpecies)
+        return FALSE;
+
+    for (i = 0; i < filter->numBannedMonIds; i++)
+    {
+        if (filter->bannedMonIds[i] == monId)
+            return FALSE;
+    }
+    return TRUE;
+}
 
-        numMons = (sInitialRentalMonRanges[adder + challenge][1] - sInitialRentalMonRanges[adder + challenge][0]) + 1;
-        monId = Random() % numMons;
-        monId += sInitialRentalMonRanges[adder + challenge][0];
+// Picks a random monId in range that the filter allows. Every allowed Pokémon is as
+// likely as it would be when rerolling GetFactoryMonId until one is allowed, but this
+// takes a single random number. Returns -1 if there are none.
+static s32 ChooseFactoryMon(const u16 *range, const struct FactoryPartyFilter *filter)
+{
+    u16 monId;
+    s32 numAllowed = 0;
+
+    for (monId = range[0]; monId <= range[1]; monId++)
+    {
+        if (IsFactoryMonAllowed(monId, filter))
+            numAllowed++;
     }
+    if (numAllowed == 0)
+        return -1;
 
+    numAllowed = Random() % numAllowed;
+    for (monId = range[0]; monId <= range[1]; monId++)
+    {
+        if (IsFactoryMonAllowed(monId, filter) && numAllowed-- == 0)
+            break;
+    }
     return monId;
 }
+#endif
 
 u8 GetNumPastRentalsRank(u8 battleMode, u8 lvlMode)
 {
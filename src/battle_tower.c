@@ -71,6 +71,11 @@ static void SetNextBattleTentOpponent(void);
 static void CopyEReaderTrainerFarewellMessage(void);
 static void ClearBattleTowerRecord(struct EmeraldBattleTowerRecord *record);
 static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount);
+static void CreateFacilityTrainerMon(struct Pokemon *mon, u16 monId, u8 level, u8 fixedIV, u32 otID);
+#ifndef FRONTIER_PARTY_RNG_COMPAT
+static void GetEnemyPartyUsage(struct FrontierPartyUsage *usage, u8 numMons);
+static s32 ChooseUnusedFrontierMon(const u16 *monSet, u8 numMons, u16 maxMonId, const struct FrontierPartyUsage *usage);
+#endif
 static void FillTentTrainerParty_(u16 trainerId, u8 firstMonId, u8 monCount);
 static void FillFactoryFrontierTrainerParty(u16 trainerId, u8 firstMonId);
 static void FillFactoryTentTrainerParty(u16 trainerId, u8 firstMonId);
@@ -1633,11 +1638,15 @@ static void FillTentTrainerParty(u8 monsCount)
 static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount)
 {
     s32 i, j;
+#ifdef FRONTIER_PARTY_RNG_COMPAT
     u16 chosenMonIndices[MAX_FRONTIER_PARTY_SIZE];
-    u8 friendship = MAX_FRIENDSHIP;
+#else
+    struct FrontierPartyUsage usage;
+#endif
     u8 level = SetFacilityPtrsGetLevel();
     u8 fixedIV = 0;
     u8 bfMonCount;
+    u16 maxMonId;
     const u16 *monSet = NULL;
     u32 otID = 0;
 
@@ -1680,20 +1689,27 @@ static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount)
     }
 
     // Regular battle frontier trainer.
-    // Attempt to fill the trainer's party with random Pokémon until 3 have been
-    // successfully chosen. The trainer's party may not have duplicate Pokémon species
-    // or duplicate held items.
+    // Fill the trainer's party with random Pokémon from its set. The trainer's party
+    // may not have duplicate Pokémon species or duplicate held items.
     for (bfMonCount = 0; monSet[bfMonCount] != 0xFFFF; bfMonCount++)
         ;
-    i = 0;
+
+    // "High tier" Pokémon are only allowed on open level mode
+    // 20 is not a possible value for level here
+    if (level == FRONTIER_MAX_LEVEL_50 || level == 20)
+        maxMonId = FRONTIER_MONS_HIGH_TIER;
+    else
+        maxMonId = 0xFFFF;
+
     otID = Random32();
+#ifdef FRONTIER_PARTY_RNG_COMPAT
+    // Attempt to fill the party until 3 have been successfully chosen.
+    i = 0;
     while (i != monCount)
     {
         u16 monId = monSet[Random() % bfMonCount];
 
-        // "High tier" Pokémon are only allowed on open level mode
-        // 20 is not a possible value for level here
-        if ((level == FRONTIER_MAX_LEVEL_50 || level == 20) && monId > FRONTIER_MONS_HIGH_TIER)
+        if (monId > maxMonId)
             continue;
 
         // Ensure this Pokémon species isn't a duplicate.
@@ -1728,31 +1744,122 @@ static void FillTrainerParty(u16 trainerId, u8 firstMonId, u8 monCount)
         chosenMonIndices[i] = monId;
 
         // Place the chosen Pokémon into the trainer's party.
-        CreateMonWithEVSpreadNatureOTID(&gEnemyParty[i + firstMonId],
-                                             gFacilityTrainerMons[monId].species,
-                                             level,
-                                             gFacilityTrainerMons[monId].nature,
-                                             fixedIV,
-                                             gFacilityTrainerMons[monId].evSpread,
-                                             otID);
-
-        friendship = MAX_FRIENDSHIP;
-        // Give the chosen Pokémon its specified moves.
-        for (j = 0; j < MAX_MON_MOVES; j++)
-        {
-            SetMonMoveSlot(&gEnemyParty[i + firstMonId], gFacilityTrainerMons[monId].moves[j], j);
-            if (gFacilityTrainerMons[monId].moves[j] == MOVE_FRUSTRATION)
-                friendship = 0;  // Frustration is more powerful the lower the pokemon's friendship is.
-        }
-
-        SetMonData(&gEnemyParty[i + firstMonId], MON_DATA_FRIENDSHIP, &friendship);
-        SetMonData(&gEnemyParty[i + firstMonId], MON_DATA_HELD_ITEM, &gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
+        CreateFacilityTrainerMon(&gEnemyParty[i + firstMonId], monId, level, fixedIV, otID);
 
         // The Pokémon was successfully added to the trainer's party, so it's safe to move on to
         // the next party slot.
         i++;
     }
+#else
+    // Only pick from the Pokémon that would be allowed, so no random draws are wasted.
+    GetEnemyPartyUsage(&usage, firstMonId);
+    for (i = 0; i < monCount; i++)
+    {
+        s32 monId = ChooseUnusedFrontierMon(monSet, bfMonCount, maxMonId, &usage);
+        if (monId < 0)
+            break;
+
+        AddFrontierPartyUsage(&usage, gFacilityTrainerMons[monId].species, gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
+        CreateFacilityTrainerMon(&gEnemyParty[i + firstMonId], monId, level, fixedIV, otID);
+    }
+#endif
+}
+
+static void CreateFacilityTrainerMon(struct Pokemon *mon, u16 monId, u8 level, u8 fixedIV, u32 otID)
+{
+    s32 i;
+    u8 friendship = MAX_FRIENDSHIP;
+
+    CreateMonWithEVSpreadNatureOTID(mon,
+                                         gFacilityTrainerMons[monId].species,
+                                         level,
+                                         gFacilityTrainerMons[monId].nature,
+                                         fixedIV,
+                                         gFacilityTrainerMons[monId].evSpread,
+                                         otID);
+
+    // Give the chosen Pokémon its specified moves.
+    for (i = 0; i < MAX_MON_MOVES; i++)
+    {
+        SetMonMoveSlot(mon, gFacilityTrainerMons[monId].moves[i], i);
+        if (gFacilityTrainerMons[monId].moves[i] == MOVE_FRUSTRATION)
+            friendship = 0;  // Frustration is more powerful the lower the pokemon's friendship is.
+    }
+
+    SetMonData(mon, MON_DATA_FRIENDSHIP, &friendship);
+    SetMonData(mon, MON_DATA_HELD_ITEM, &gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
+}
+
+void ClearFrontierPartyUsage(struct FrontierPartyUsage *usage)
+{
+    memset(usage, 0, sizeof(*usage));
+}
+
+void AddFrontierPartyUsage(struct FrontierPartyUsage *usage, u16 species, u16 heldItem)
+{
+    if (species < NUM_SPECIES)
+        usage->species[species / 32] |= 1u << (species % 32);
+    if (heldItem != ITEM_NONE && heldItem < ITEMS_COUNT)
+        usage->heldItems[heldItem / 32] |= 1u << (heldItem % 32);
+}
+
+bool32 IsFrontierPartySpeciesUsed(const struct FrontierPartyUsage *usage, u16 species)
+{
+    if (species >= NUM_SPECIES)
+        return FALSE;
+    return (usage->species[species / 32] >> (species % 32)) & 1;
+}
+
+// Parties may have any number of Pokémon without a held item.
+bool32 IsFrontierPartyHeldItemUsed(const struct FrontierPartyUsage *usage, u16 heldItem)
+{
+    if (heldItem == ITEM_NONE || heldItem >= ITEMS_COUNT)
+        return FALSE;
+    return (usage->heldItems[heldItem / 32] >> (heldItem % 32)) & 1;
+}
+
+#ifndef FRONTIER_PARTY_RNG_COMPAT
+static void GetEnemyPartyUsage(struct FrontierPartyUsage *usage, u8 numMons)
+{
+    s32 i;
+
+    ClearFrontierPartyUsage(usage);
+    for (i = 0; i < numMons; i++)
+        AddFrontierPartyUsage(usage, GetMonData(&gEnemyParty[i], MON_DATA_SPECIES), GetMonData(&gEnemyParty[i], MON_DATA_HELD_ITEM));
+}
+
+static bool32 IsFrontierMonUnused(u16 monId, u16 maxMonId, const struct FrontierPartyUsage *usage)
+{
+    return monId <= maxMonId
+        && !IsFrontierPartySpeciesUsed(usage, gFacilityTrainerMons[monId].species)
+        && !IsFrontierPartyHeldItemUsed(usage, gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
+}
+
+// Picks a random entry of monSet whose species and held item aren't used yet.
+// Every allowed entry is as likely as it would be when rerolling until one is
+// allowed, but this takes a single random number. Returns -1 if there are none.
+static s32 ChooseUnusedFrontierMon(const u16 *monSet, u8 numMons, u16 maxMonId, const struct FrontierPartyUsage *usage)
+{
+    s32 i;
+    s32 numAllowed = 0;
+
+    for (i = 0; i < numMons; i++)
+    {
+        if (IsFrontierMonUnused(monSet[i], maxMonId, usage))
+            numAllowed++;
+    }
+    if (numAllowed == 0)
+        return -1;
+
+    numAllowed = Random() % numAllowed;
+    for (i = 0; i < numMons; i++)
+    {
+        if (IsFrontierMonUnused(monSet[i], maxMonId, usage) && numAllowed-- == 0)
+            break;
+    }
+    return monSet[i];
 }
+#endif
 
 // Probably an early draft before the 'CreateApprenticeMon' was written.
 static void UNUSED Unused_CreateApprenticeMons(u16 trainerId, u8 firstMonId)
@@ -3381,9 +3488,13 @@ static void SetNextBattleTentOpponent(void)
 
 static void FillTentTrainerParty_(u16 trainerId, u8 firstMonId, u8 monCount)
 {
-    s32 i, j;
+    s32 i;
+#ifdef FRONTIER_PARTY_RNG_COMPAT
+    s32 j;
     u16 chosenMonIndices[MAX_FRONTIER_PARTY_SIZE];
-    u8 friendship;
+#else
+    struct FrontierPartyUsage usage;
+#endif
     u8 level = SetTentPtrsGetLevel();
     u8 fixedIV = 0;
     u8 bfMonCount;
@@ -3403,8 +3514,9 @@ static void FillTentTrainerParty_(u16 trainerId, u8 firstMonId, u8 monCount)
             break;
     }
 
-    i = 0;
     otID = Random32();
+#ifdef FRONTIER_PARTY_RNG_COMPAT
+    i = 0;
     while (i != monCount)
     {
         u16 monId = monSet[Random() % bfMonCount];
@@ -3441,30 +3553,24 @@ static void FillTentTrainerParty_(u16 trainerId, u8 firstMonId, u8 monCount)
         chosenMonIndices[i] = monId;
 
         // Place the chosen Pokémon into the trainer's party.
-        CreateMonWithEVSpreadNatureOTID(&gEnemyParty[i + firstMonId],
-                                             gFacilityTrainerMons[monId].species,
-                                             level,
-                                             gFacilityTrainerMons[monId].nature,
-                                             fixedIV,
-                                             gFacilityTrainerMons[monId].evSpread,
-                                             otID);
-
-        friendship = MAX_FRIENDSHIP;
-        // Give the chosen Pokémon its specified moves.
-        for (j = 0; j < MAX_MON_MOVES; j++)
-        {
-            SetMonMoveSlot(&gEnemyParty[i + firstMonId], gFacilityTrainerMons[monId].moves[j], j);
-            if (gFacilityTrainerMons[monId].moves[j] == MOVE_FRUSTRATION)
-                friendship = 0;  // Frustration is more powerful the lower the pokemon's friendship is.
-        }
-
-        SetMonData(&gEnemyParty[i + firstMonId], MON_DATA_FRIENDSHIP, &friendship);
-        SetMonData(&gEnemyParty[i + firstMonId], MON_DATA_HELD_ITEM, &gBattleFrontierHeldItems[gFacilityTrainerMons[monId].itemTableId]);
+        CreateFacilityTrainerMon(&gEnemyParty[i + firstMonId], monId, level, fixedIV, otID);
 
         // The Pokémon was successfully added to the trainer's party, so it's safe to move on to
         // the next party slot.
         i++;
     }
+#else
+    GetEnemyPartyUsage(&usage, firstMonId);
+    for (i = 0; i < monCount; i++)
+    {
+        s32 chosenMonId = ChooseUnusedFrontierMon(monSet, bfMonCount, 0xFFFF, &usage);
+        if (chosenMonId < 0)
+            break;
+
+        AddFrontierPartyUsage(&usage, gFacilityTrainerMons[chosenMonId].species, gBattleFrontierHeldItems[gFacilityTrainerMons[chosenMonId].itemTableId]);
+        CreateFacilityTrainerMon(&gEnemyParty[i + firstMonId], chosenMonId, level, fixedIV, otID);
+    }
+#endif
 }
 
 u8 FacilityClassToGraphicsId(u8 facilityClass)
@@ -131,22 +131,16 @@ static void Task_FrontierSquaresScroll(u8);
 static void Task_FrontierSquaresSpiral(u8);
 static void VBlankCB_BattleTransition(void);
 static void VBlankCB_Swirl(void);
-static void HBlankCB_Swirl(void);
 static void VBlankCB_Shuffle(void);
-static void HBlankCB_Shuffle(void);
 static void VBlankCB_PatternWeave(void);
 static void VBlankCB_CircularMask(void);
 static void VBlankCB_ClockwiseWipe(void);
 static void VBlankCB_Ripple(void);
-static void HBlankCB_Ripple(void);
 static void VBlankCB_FrontierLogoWave(void);
-static void HBlankCB_FrontierLogoWave(void);
 static void VBlankCB_Wave(void);
 static void VBlankCB_Slice(void);
-static void HBlankCB_Slice(void);
 static void VBlankCB_WhiteBarsFade(void);
 static void VBlankCB_WhiteBarsFade_Blend(void);
-static void HBlankCB_WhiteBarsFade(void);
 static void VBlankCB_AngledWipes(void);
 static void VBlankCB_Rayquaza(void);
 static bool8 Blur_Init(struct Task *);
@@ -1199,7 +1193,7 @@ static bool8 Swirl_Init(struct Task *task)
     SetSinWave(gScanlineEffectRegBuffers[1], sTransitionData->cameraX, 0, 2, 0, DISPLAY_HEIGHT);
 
     SetVBlankCallback(VBlankCB_Swirl);
-    SetHBlankCallback(HBlankCB_Swirl);
+    SetHBlankCallback(ScanlineEffect_GetHBlankCallback(SCANLINE_HBLANK_BG123_HOFS));
 
     EnableInterrupts(INTR_FLAG_VBLANK | INTR_FLAG_HBLANK);
 
@@ -1232,14 +1226,6 @@ static void VBlankCB_Swirl(void)
         DmaCopy16(3, gScanlineEffectRegBuffers[0], gScanlineEffectRegBuffers[1], DISPLAY_HEIGHT * 2);
 }
 
-static void HBlankCB_Swirl(void)
-{
-    u16 var = gScanlineEffectRegBuffers[1][REG_VCOUNT];
-    REG_BG1HOFS = var;
-    REG_BG2HOFS = var;
-    REG_BG3HOFS = var;
-}
-
 #undef tSinIndex
 #undef tAmplitude
 
@@ -1264,7 +1250,7 @@ static bool8 Shuffle_Init(struct Task *task)
     memset(gScanlineEffectRegBuffers[1], sTransitionData->cameraY, DISPLAY_HEIGHT * 2);
 
     SetVBlankCallback(VBlankCB_Shuffle);
-    SetHBlankCallback(HBlankCB_Shuffle);
+    SetHBlankCallback(ScanlineEffect_GetHBlankCallback(SCANLINE_HBLANK_BG123_VOFS));
 
     EnableInterrupts(INTR_FLAG_VBLANK | INTR_FLAG_HBLANK);
 
@@ -1303,14 +1289,6 @@ static void VBlankCB_Shuffle(void)
         DmaCopy16(3, gScanlineEffectRegBuffers[0], gScanlineEffectRegBuffers[1], DISPLAY_HEIGHT * 2);
 }
 
-static void HBlankCB_Shuffle(void)
-{
-    u16 var = gScanlineEffectRegBuffers[1][REG_VCOUNT];
-    REG_BG1VOFS = var;
-    REG_BG2VOFS = var;
-    REG_BG3VOFS = var;
-}
-
 #undef tSinVal
 #undef tAmplitude
 
@@ -2091,7 +2069,7 @@ static bool8 Ripple_Init(struct Task *task)
         gScanlineEffectRegBuffers[1][i] = sTransitionData->cameraY;
 
     SetVBlankCallback(VBlankCB_Ripple);
-    SetHBlankCallback(HBlankCB_Ripple);
+    SetHBlankCallback(ScanlineEffect_GetHBlankCallback(SCANLINE_HBLANK_BG123_VOFS));
 
     EnableInterrupts(INTR_FLAG_HBLANK);
 
@@ -2140,14 +2118,6 @@ static void VBlankCB_Ripple(void)
         DmaCopy16(3, gScanlineEffectRegBuffers[0], gScanlineEffectRegBuffers[1], DISPLAY_HEIGHT * 2);
 }
 
-static void HBlankCB_Ripple(void)
-{
-    u16 var = gScanlineEffectRegBuffers[1][REG_VCOUNT];
-    REG_BG1VOFS = var;
-    REG_BG2VOFS = var;
-    REG_BG3VOFS = var;
-}
-
 #undef tSinVal
 #undef tAmplitudeVal
 #undef tTimer
@@ -2749,7 +2719,7 @@ static bool8 Slice_Init(struct Task *task)
     SetGpuRegBits(REG_OFFSET_DISPSTAT, DISPSTAT_HBLANK_INTR);
 
     SetVBlankCallback(VBlankCB_Slice);
-    SetHBlankCallback(HBlankCB_Slice);
+    SetHBlankCallback(ScanlineEffect_GetHBlankCallback(SCANLINE_HBLANK_BG123_HOFS_VISIBLE));
 
     task->tState++;
     return TRUE;
@@ -2814,17 +2784,6 @@ static void VBlankCB_Slice(void)
     DmaSet(0, &gScanlineEffectRegBuffers[1][DISPLAY_HEIGHT], &REG_WIN0H, B_TRANS_DMA_FLAGS);
 }
 
-static void HBlankCB_Slice(void)
-{
-    if (REG_VCOUNT < DISPLAY_HEIGHT)
-    {
-        u16 var = gScanlineEffectRegBuffers[1][REG_VCOUNT];
-        REG_BG1HOFS = var;
-        REG_BG2HOFS = var;
-        REG_BG3HOFS = var;
-    }
-}
-
 #undef tEffectX
 #undef tSpeed
 #undef tAccel
@@ -2873,7 +2832,7 @@ static bool8 ShredSplit_Init(struct Task *task)
     EnableInterrupts(INTR_FLAG_HBLANK);
 
     SetVBlankCallback(VBlankCB_Slice);
-    SetHBlankCallback(HBlankCB_Slice);
+    SetHBlankCallback(ScanlineEffect_GetHBlankCallback(SCANLINE_HBLANK_BG123_HOFS_VISIBLE));
 
     task->tState++;
     return TRUE;
@@ -3609,7 +3568,7 @@ static bool8 WhiteBarsFade_Init(struct Task *task)
     }
 
     EnableInterrupts(INTR_FLAG_HBLANK);
-    SetHBlankCallback(HBlankCB_WhiteBarsFade);
+    SetHBlankCallback(ScanlineEffect_GetHBlankCallback(SCANLINE_HBLANK_BLDY));
     SetVBlankCallback(VBlankCB_WhiteBarsFade);
 
     task->tState++;
@@ -3703,11 +3662,6 @@ static void VBlankCB_WhiteBarsFade_Blend(void)
     REG_WIN0V = sTransitionData->WIN0V;
 }
 
-static void HBlankCB_WhiteBarsFade(void)
-{
-    REG_BLDY = gScanlineEffectRegBuffers[1][REG_VCOUNT];
-}
-
 static void SpriteCB_WhiteBarFade(struct Sprite *sprite)
 {
     if (sprite->sDelay)
@@ -4333,7 +4287,7 @@ static bool8 FrontierLogoWave_InitScanline(struct Task *task)
         gScanlineEffectRegBuffers[1][i] = sTransitionData->cameraY;
 
     SetVBlankCallback(VBlankCB_FrontierLogoWave);
-    SetHBlankCallback(HBlankCB_FrontierLogoWave);
+    SetHBlankCallback(ScanlineEffect_GetHBlankCallback(SCANLINE_HBLANK_BG0_VOFS));
     EnableInterrupts(INTR_FLAG_HBLANK);
 
     task->tState++;
@@ -4405,12 +4359,6 @@ static void VBlankCB_FrontierLogoWave(void)
         DmaCopy16(3, gScanlineEffectRegBuffers[0], gScanlineEffectRegBuffers[1], DISPLAY_HEIGHT * 2);
 }
 
-static void HBlankCB_FrontierLogoWave(void)
-{
-    u16 var = gScanlineEffectRegBuffers[1][REG_VCOUNT];
-    REG_BG0VOFS = var;
-}
-
 #undef tSinVal
 #undef tAmplitudeVal
 #undef tTimer
@@ -4506,6 +4454,7 @@ static bool8 FrontierSquares_Shrink(struct Task *task)
                 gPlttBufferUnfaded[i] = RGB_BLACK;
                 gPlttBufferFaded[i] = RGB_BLACK;
             }
+            MarkPaletteRangeDirty(BG_PLTT_ID(15) + 10, 5);
             break;
         case 1:
             BlendPalettes(PALETTES_ALL & ~(1 << 15), 16, RGB_BLACK);
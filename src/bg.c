@@ -42,11 +42,28 @@ static struct BgControl sGpuBgConfigs;
 static struct BgConfig2 sGpuBgConfigs2[NUM_BACKGROUNDS];
 static u32 sDmaBusyBitfield[NUM_BACKGROUNDS];
 
+// The range of rows in each BG's tilemap buffer that may differ from VRAM, in units
+// of TILEMAP_DIRTY_ROW_SIZE bytes. This is only used for buffers owned by the window
+// system; see EnableBgTilemapDirtyRows.
+#define TILEMAP_DIRTY_ROW_SIZE 0x40
+#define TILEMAP_DIRTY_ROWS_ALL 0xFFFF
+
+struct BgTilemapDirtyRows
+{
+    u16 first;
+    u16 end;
+    bool8 enabled;
+};
+
+static struct BgTilemapDirtyRows sBgTilemapDirtyRows[NUM_BACKGROUNDS];
+
 COMMON_DATA u32 gWindowTileAutoAllocEnabled = 0;
 
 static const struct BgConfig sZeroedBgControlStruct = { 0 };
 
 static u32 GetBgType(u8 bg);
+static void ResetBgTilemapDirtyRows(u8 bg, bool8 enabled);
+static void MarkBgTilemapDirty(u8 bg, u32 firstOffset, u32 lastOffset);
 
 void ResetBgs(void)
 {
@@ -57,6 +74,12 @@ void ResetBgs(void)
 
 static void SetBgModeInternal(u8 bgMode)
 {
+    int i;
+
+    // Changing the mode can change the layout of every tilemap.
+    for (i = 0; i < NUM_BACKGROUNDS; i++)
+        ResetBgTilemapDirtyRows(i, sBgTilemapDirtyRows[i].enabled);
+
     sGpuBgConfigs.bgVisibilityAndMode &= ~0x7;
     sGpuBgConfigs.bgVisibilityAndMode |= bgMode;
 }
@@ -108,11 +131,13 @@ static void SetBgControlAttributes(u8 bg, u8 charBaseIndex, u8 mapBaseIndex, u8
         if (mapBaseIndex != 0xFF)
         {
             sGpuBgConfigs.configs[bg].mapBaseIndex = mapBaseIndex;
+            ResetBgTilemapDirtyRows(bg, sBgTilemapDirtyRows[bg].enabled);
         }
 
         if (screenSize != 0xFF)
         {
             sGpuBgConfigs.configs[bg].screenSize = screenSize;
+            ResetBgTilemapDirtyRows(bg, sBgTilemapDirtyRows[bg].enabled);
         }
 
         if (paletteMode != 0xFF)
@@ -338,6 +363,7 @@ void InitBgsFromTemplates(u8 bgMode, const struct BgTemplate *templates, u8 numT
             sGpuBgConfigs2[bg].tilemap = NULL;
             sGpuBgConfigs2[bg].bg_x = 0;
             sGpuBgConfigs2[bg].bg_y = 0;
+            ResetBgTilemapDirtyRows(bg, FALSE);
         }
     }
 }
@@ -364,6 +390,7 @@ void InitBgFromTemplate(const struct BgTemplate *template)
         sGpuBgConfigs2[bg].tilemap = NULL;
         sGpuBgConfigs2[bg].bg_x = 0;
         sGpuBgConfigs2[bg].bg_y = 0;
+        ResetBgTilemapDirtyRows(bg, FALSE);
     }
 }
 
@@ -410,6 +437,10 @@ u16 LoadBgTilemap(u8 bg, const void *src, u16 size, u16 destOffset)
         return -1;
     }
 
+    // VRAM no longer matches the tilemap buffer.
+    if (!IsInvalidBg32(bg))
+        ResetBgTilemapDirtyRows(bg, sBgTilemapDirtyRows[bg].enabled);
+
     sDmaBusyBitfield[cursor / 0x20] |= (1 << (cursor % 0x20));
 
     return cursor;
@@ -850,6 +881,19 @@ void SetBgTilemapBuffer(u8 bg, void *tilemap)
     if (!IsInvalidBg32(bg) && GetBgControlAttribute(bg, BG_CTRL_ATTR_VISIBLE))
     {
         sGpuBgConfigs2[bg].tilemap = tilemap;
+        ResetBgTilemapDirtyRows(bg, FALSE);
+    }
+}
+
+// Only the rows of the tilemap buffer that were changed through the functions
+// in this file will be copied by CopyBgTilemapBufferToVram. This is only safe
+// for a buffer that nothing else can write to, so it's used for the buffers
+// allocated by the window system, and GetBgTilemapBuffer turns it back off.
+void EnableBgTilemapDirtyRows(u8 bg)
+{
+    if (!IsInvalidBg32(bg) && GetBgControlAttribute(bg, BG_CTRL_ATTR_VISIBLE))
+    {
+        ResetBgTilemapDirtyRows(bg, TRUE);
     }
 }
 
@@ -858,6 +902,7 @@ void UnsetBgTilemapBuffer(u8 bg)
     if (!IsInvalidBg32(bg) && GetBgControlAttribute(bg, BG_CTRL_ATTR_VISIBLE))
     {
         sGpuBgConfigs2[bg].tilemap = NULL;
+        ResetBgTilemapDirtyRows(bg, FALSE);
     }
 }
 
@@ -867,8 +912,10 @@ void *GetBgTilemapBuffer(u8 bg)
         return NULL;
     else if (!GetBgControlAttribute(bg, BG_CTRL_ATTR_VISIBLE))
         return NULL;
-    else
-        return sGpuBgConfigs2[bg].tilemap;
+
+    // The caller may write to the buffer directly.
+    sBgTilemapDirtyRows[bg].enabled = FALSE;
+    return sGpuBgConfigs2[bg].tilemap;
 }
 
 void CopyToBgTilemapBuffer(u8 bg, const void *src, u16 mode, u16 destOffset)
@@ -876,15 +923,22 @@ void CopyToBgTilemapBuffer(u8 bg, const void *src, u16 mode, u16 destOffset)
     if (!IsInvalidBg32(bg) && !IsTileMapOutsideWram(bg))
     {
         if (mode != 0)
+        {
             CpuCopy16(src, (void *)(sGpuBgConfigs2[bg].tilemap + (destOffset * 2)), mode);
+            MarkBgTilemapDirty(bg, destOffset * 2, destOffset * 2 + mode - 1);
+        }
         else
+        {
             LZ77UnCompWram(src, (void *)(sGpuBgConfigs2[bg].tilemap + (destOffset * 2)));
+            ResetBgTilemapDirtyRows(bg, sBgTilemapDirtyRows[bg].enabled);
+        }
     }
 }
 
 void CopyBgTilemapBufferToVram(u8 bg)
 {
     u16 sizeToLoad;
+    u32 first, end;
 
     if (!IsInvalidBg32(bg) && !IsTileMapOutsideWram(bg))
     {
@@ -900,7 +954,26 @@ void CopyBgTilemapBufferToVram(u8 bg)
             sizeToLoad = 0;
             break;
         }
-        LoadBgVram(bg, sGpuBgConfigs2[bg].tilemap, sizeToLoad, 0, 2);
+
+        if (!sBgTilemapDirtyRows[bg].enabled)
+        {
+            LoadBgVram(bg, sGpuBgConfigs2[bg].tilemap, sizeToLoad, 0, 2);
+            return;
+        }
+
+        first = sBgTilemapDirtyRows[bg].first * TILEMAP_DIRTY_ROW_SIZE;
+        end = sBgTilemapDirtyRows[bg].end * TILEMAP_DIRTY_ROW_SIZE;
+        if (end > sizeToLoad)
+            end = sizeToLoad;
+        if (first >= end)
+            return;
+
+        // If the copy couldn't be queued, the rows stay dirty for the next one.
+        if (LoadBgVram(bg, sGpuBgConfigs2[bg].tilemap + first, end - first, first, 2) != 0xFF)
+        {
+            sBgTilemapDirtyRows[bg].first = TILEMAP_DIRTY_ROWS_ALL;
+            sBgTilemapDirtyRows[bg].end = 0;
+        }
     }
 }
 
@@ -924,6 +997,8 @@ void CopyToBgTilemapBufferRect(u8 bg, const void *src, u8 destX, u8 destY, u8 wi
                     ((u16 *)sGpuBgConfigs2[bg].tilemap)[((destY16 * 0x20) + destX16)] = *srcCopy++;
                 }
             }
+            if (width != 0 && height != 0)
+                MarkBgTilemapDirty(bg, ((destY * 0x20) + destX) * 2, (((destY + height - 1) * 0x20) + destX + width - 1) * 2 + 1);
             break;
         }
         case BG_TYPE_AFFINE:
@@ -937,6 +1012,8 @@ void CopyToBgTilemapBufferRect(u8 bg, const void *src, u8 destX, u8 destY, u8 wi
                     ((u8 *)sGpuBgConfigs2[bg].tilemap)[((destY16 * mode) + destX16)] = *srcCopy++;
                 }
             }
+            if (width != 0 && height != 0)
+                MarkBgTilemapDirty(bg, (destY * mode) + destX, ((destY + height - 1) * mode) + destX + width - 1);
             break;
         }
         }
@@ -954,6 +1031,7 @@ void CopyRectToBgTilemapBufferRect(u8 bg, const void *src, u8 srcX, u8 srcY, u8
     u16 var;
     const void *srcPtr;
     u16 i, j;
+    u16 minIndex = 0xFFFF, maxIndex = 0;
 
     if (!IsInvalidBg32(bg) && !IsTileMapOutsideWram(bg))
     {
@@ -971,9 +1049,15 @@ void CopyRectToBgTilemapBufferRect(u8 bg, const void *src, u8 srcX, u8 srcY, u8
                     u16 index = GetTileMapIndexFromCoords(j, i, screenSize, screenWidth, screenHeight);
                     CopyTileMapEntry(srcPtr, sGpuBgConfigs2[bg].tilemap + (index * 2), palette1, tileOffset, palette2);
                     srcPtr += 2;
+                    if (index < minIndex)
+                        minIndex = index;
+                    if (index > maxIndex)
+                        maxIndex = index;
                 }
                 srcPtr += (srcWidth - rectWidth) * 2;
             }
+            if (minIndex <= maxIndex)
+                MarkBgTilemapDirty(bg, minIndex * 2, maxIndex * 2 + 1);
             break;
         case BG_TYPE_AFFINE:
             srcPtr = src + ((srcY * srcWidth) + srcX);
@@ -987,6 +1071,8 @@ void CopyRectToBgTilemapBufferRect(u8 bg, const void *src, u8 srcX, u8 srcY, u8
                 }
                 srcPtr += (srcWidth - rectWidth);
             }
+            if (rectWidth != 0 && rectHeight != 0)
+                MarkBgTilemapDirty(bg, (var * destY) + destX, (var * (destY + rectHeight - 1)) + destX + rectWidth - 1);
             break;
         }
     }
@@ -1010,6 +1096,8 @@ void FillBgTilemapBufferRect_Palette0(u8 bg, u16 tileNum, u8 x, u8 y, u8 width,
                     ((u16 *)sGpuBgConfigs2[bg].tilemap)[((y16 * 0x20) + x16)] = tileNum;
                 }
             }
+            if (width != 0 && height != 0)
+                MarkBgTilemapDirty(bg, ((y * 0x20) + x) * 2, (((y + height - 1) * 0x20) + x + width - 1) * 2 + 1);
             break;
         case BG_TYPE_AFFINE:
             mode = GetBgMetricAffineMode(bg, 0x1);
@@ -1020,6 +1108,8 @@ void FillBgTilemapBufferRect_Palette0(u8 bg, u16 tileNum, u8 x, u8 y, u8 width,
                     ((u8 *)sGpuBgConfigs2[bg].tilemap)[((y16 * mode) + x16)] = tileNum;
                 }
             }
+            if (width != 0 && height != 0)
+                MarkBgTilemapDirty(bg, (y * mode) + x, ((y + height - 1) * mode) + x + width - 1);
             break;
         }
     }
@@ -1037,6 +1127,8 @@ void WriteSequenceToBgTilemapBuffer(u8 bg, u16 firstTileNum, u8 x, u8 y, u8 widt
     u16 attribute;
     u16 mode3;
     u16 x16, y16;
+    u16 index;
+    u16 minIndex = 0xFFFF, maxIndex = 0;
 
     if (!IsInvalidBg32(bg) && !IsTileMapOutsideWram(bg))
     {
@@ -1050,10 +1142,17 @@ void WriteSequenceToBgTilemapBuffer(u8 bg, u16 firstTileNum, u8 x, u8 y, u8 widt
             {
                 for (x16 = x; x16 < (x + width); x16++)
                 {
-                    CopyTileMapEntry(&firstTileNum, &((u16 *)sGpuBgConfigs2[bg].tilemap)[(u16)GetTileMapIndexFromCoords(x16, y16, attribute, mode, mode2)], paletteSlot, 0, 0);
+                    index = GetTileMapIndexFromCoords(x16, y16, attribute, mode, mode2);
+                    CopyTileMapEntry(&firstTileNum, &((u16 *)sGpuBgConfigs2[bg].tilemap)[index], paletteSlot, 0, 0);
                     firstTileNum = (firstTileNum & 0xFC00) + ((firstTileNum + tileNumDelta) & 0x3FF);
+                    if (index < minIndex)
+                        minIndex = index;
+                    if (index > maxIndex)
+                        maxIndex = index;
                 }
             }
+            if (minIndex <= maxIndex)
+                MarkBgTilemapDirty(bg, minIndex * 2, maxIndex * 2 + 1);
             break;
         case BG_TYPE_AFFINE:
             mode3 = GetBgMetricAffineMode(bg, 0x1);
@@ -1065,6 +1164,8 @@ void WriteSequenceToBgTilemapBuffer(u8 bg, u16 firstTileNum, u8 x, u8 y, u8 widt
                     firstTileNum = (firstTileNum & 0xFC00) + ((firstTileNum + tileNumDelta) & 0x3FF);
                 }
             }
+            if (width != 0 && height != 0)
+                MarkBgTilemapDirty(bg, (y * mode3) + x, ((y + height - 1) * mode3) + x + width - 1);
             break;
         }
     }
@@ -1189,6 +1290,25 @@ void CopyTileMapEntry(const u16 *src, u16 *dest, s32 palette1, s32 tileOffset, s
     *dest = var;
 }
 
+static void ResetBgTilemapDirtyRows(u8 bg, bool8 enabled)
+{
+    sBgTilemapDirtyRows[bg].first = 0;
+    sBgTilemapDirtyRows[bg].end = TILEMAP_DIRTY_ROWS_ALL;
+    sBgTilemapDirtyRows[bg].enabled = enabled;
+}
+
+// firstOffset and lastOffset are the first and last bytes written, inclusive.
+static void MarkBgTilemapDirty(u8 bg, u32 firstOffset, u32 lastOffset)
+{
+    u32 first = firstOffset / TILEMAP_DIRTY_ROW_SIZE;
+    u32 end = lastOffset / TILEMAP_DIRTY_ROW_SIZE + 1;
+
+    if (first < sBgTilemapDirtyRows[bg].first)
+        sBgTilemapDirtyRows[bg].first = first;
+    if (end > sBgTilemapDirtyRows[bg].end)
+        sBgTilemapDirtyRows[bg].end = end;
+}
+
 static u32 GetBgType(u8 bg)
 {
     u8 mode = GetBgMode();
@@ -3,27 +3,162 @@
 #include "data.h"
 #include "decompress.h"
 #include "pokemon.h"
+#include "task.h"
 #include "text.h"
 
+// When this is TRUE, LZDecompressWram and LZDecompressVram run the ARM decompressors
+// in lz77_decompress.s from IWRAM, which are faster than the BIOS functions. Code that
+// needs the BIOS functions can still call LZ77UnCompWram/LZ77UnCompVram directly.
+#define LZ_DECOMPRESS_IN_IWRAM TRUE
+
+#if LZ_DECOMPRESS_IN_IWRAM
+void LZ77UnCompWram_Arm(const u32 *src, void *dest);
+void LZ77UnCompVram_Arm(const u32 *src, void *dest);
+
+static u32 sLZ77UnCompRAM_Buffer[0x50];
+static bool8 sLZ77UnCompRAM_Loaded;
+#endif
+
 EWRAM_DATA ALIGNED(4) u8 gDecompressionBuffer[0x4000] = {0};
 
 static void DuplicateDeoxysTiles(void *pointer, s32 species);
 
+#if LZ_DECOMPRESS_IN_IWRAM
+static void LoadLZ77UnCompToIwram(void)
+{
+    if (!sLZ77UnCompRAM_Loaded)
+    {
+        CpuCopy32((void *)LZ77UnCompWram_Arm, sLZ77UnCompRAM_Buffer, sizeof(sLZ77UnCompRAM_Buffer));
+        sLZ77UnCompRAM_Loaded = TRUE;
+    }
+}
+#endif
+
 void LZDecompressWram(const u32 *src, void *dest)
 {
+#if LZ_DECOMPRESS_IN_IWRAM
+    LoadLZ77UnCompToIwram();
+    ((void (*)(const u32 *, void *))sLZ77UnCompRAM_Buffer)(src, dest);
+#else
     LZ77UnCompWram(src, dest);
+#endif
 }
 
 void LZDecompressVram(const u32 *src, void *dest)
 {
+#if LZ_DECOMPRESS_IN_IWRAM
+    u8 *func = (u8 *)sLZ77UnCompRAM_Buffer + ((u8 *)LZ77UnCompVram_Arm - (u8 *)LZ77UnCompWram_Arm);
+
+    LoadLZ77UnCompToIwram();
+    ((void (*)(const u32 *, void *))func)(src, dest);
+#else
     LZ77UnCompVram(src, dest);
+#endif
+}
+
+// Prepares to decompress src to dest (in WRAM) over several calls to LZDecompressContinue.
+void LZDecompressStart(struct LZDecompressState *state, const u32 *src, void *dest)
+{
+    state->src = (const u8 *)src + 4;
+    state->dest = dest;
+    state->end = (u8 *)dest + GetDecompressedDataSize(src);
+    state->flags = 0;
+    state->flagsLeft = 0;
+}
+
+// Decompresses at least maxBytes more of the data, or all of what's left. It can write up
+// to 17 bytes more than maxBytes to finish a match. A maxBytes of 0 is treated as 1, so that
+// every call makes progress. Returns TRUE if there's still more to do.
+bool8 LZDecompressContinue(struct LZDecompressState *state, u32 maxBytes)
+{
+    const u8 *src = state->src;
+    u8 *dest = state->dest;
+    u8 *end = state->end;
+    u8 *stop;
+    u32 flags = state->flags;
+    u32 flagsLeft = state->flagsLeft;
+
+    if (maxBytes == 0)
+        maxBytes = 1;
+    if (maxBytes < (u32)(end - dest))
+        stop = dest + maxBytes;
+    else
+        stop = end;
+
+    while (dest < stop)
+    {
+        if (flagsLeft == 0)
+        {
+            flags = *src++;
+            flagsLeft = 8;
+        }
+        flagsLeft--;
+
+        if (flags & 0x80)
+        {
+            // Copy 3-18 bytes from up to 4KB back in the output
+            const u8 *copySrc = dest - (((src[0] & 0xF) << 8) | src[1]) - 1;
+            u32 length = (src[0] >> 4) + 3;
+
+            src += 2;
+            if (length > (u32)(end - dest))
+                length = end - dest;
+            while (length-- != 0)
+                *dest++ = *copySrc++;
+        }
+        else
+        {
+            *dest++ = *src++;
+        }
+        flags <<= 1;
+    }
+
+    state->src = src;
+    state->dest = dest;
+    state->flags = flags;
+    state->flagsLeft = flagsLeft;
+    return dest < end;
 }
 
+// The decompression state is kept in the task's data, from data[2] to data[9]
+#define tBytesPerFrame data[0]
+#define tState         data[2]
+
+STATIC_ASSERT(sizeof(struct LZDecompressState) <= 8 * sizeof(s16), LZDecompressStateFitsInTaskData);
+
+static void Task_LZDecompress(u8 taskId)
+{
+    struct LZDecompressState *state = (struct LZDecompressState *)&gTasks[taskId].tState;
+
+    if (!LZDecompressContinue(state, (u16)gTasks[taskId].tBytesPerFrame))
+        DestroyTask(taskId);
+}
+
+// Decompresses src to dest (in WRAM) in the background, bytesPerFrame at a time, so that
+// a scene can keep handling input while it loads. IsLZDecompressTaskActive returns FALSE
+// once every task created this way has finished.
+u8 CreateLZDecompressTask(const u32 *src, void *dest, u16 bytesPerFrame, u8 priority)
+{
+    u8 taskId = CreateTask(Task_LZDecompress, priority);
+
+    gTasks[taskId].tBytesPerFrame = bytesPerFrame;
+    LZDecompressStart((struct LZDecompressState *)&gTasks[taskId].tState, src, dest);
+    return taskId;
+}
+
+bool8 IsLZDecompressTaskActive(void)
+{
+    return FuncIsActiveTask(Task_LZDecompress);
+}
+
+#undef tBytesPerFrame
+#undef tState
+
 u16 LoadCompressedSpriteSheet(const struct CompressedSpriteSheet *src)
 {
     struct SpriteSheet dest;
 
-    LZ77UnCompWram(src->data, gDecompressionBuffer);
+    LZDecompressWram(src->data, gDecompressionBuffer);
     dest.data = gDecompressionBuffer;
     dest.size = src->size;
     dest.tag = src->tag;
@@ -34,7 +169,7 @@ void LoadCompressedSpriteSheetOverrideBuffer(const struct CompressedSpriteSheet
 {
     struct SpriteSheet dest;
 
-    LZ77UnCompWram(src->data, buffer);
+    LZDecompressWram(src->data, buffer);
     dest.data = buffer;
     dest.size = src->size;
     dest.tag = src->tag;
@@ -45,7 +180,7 @@ void LoadCompressedSpritePalette(const struct CompressedSpritePalette *src)
 {
     struct SpritePalette dest;
 
-    LZ77UnCompWram(src->data, gDecompressionBuffer);
+    LZDecompressWram(src->data, gDecompressionBuffer);
     dest.data = (void *) gDecompressionBuffer;
     dest.tag = src->tag;
     LoadSpritePalette(&dest);
@@ -55,7 +190,7 @@ void LoadCompressedSpritePaletteOverrideBuffer(const struct CompressedSpritePale
 {
     struct SpritePalette dest;
 
-    LZ77UnCompWram(src->data, buffer);
+    LZDecompressWram(src->data, buffer);
     dest.data = buffer;
     dest.tag = src->tag;
     LoadSpritePalette(&dest);
@@ -64,9 +199,9 @@ void LoadCompressedSpritePaletteOverrideBuffer(const struct CompressedSpritePale
 void DecompressPicFromTable(const struct CompressedSpriteSheet *src, void *buffer, s32 species)
 {
     if (species > NUM_SPECIES)
-        LZ77UnCompWram(gMonFrontPicTable[0].data, buffer);
+        LZDecompressWram(gMonFrontPicTable[0].data, buffer);
     else
-        LZ77UnCompWram(src->data, buffer);
+        LZDecompressWram(src->data, buffer);
     DuplicateDeoxysTiles(buffer, species);
 }
 
@@ -95,17 +230,17 @@ void LoadSpecialPokePic(const struct CompressedSpriteSheet *src, void *dest, s32
             i += SPECIES_UNOWN_B - 1;
 
         if (!isFrontPic)
-            LZ77UnCompWram(gMonBackPicTable[i].data, dest);
+            LZDecompressWram(gMonBackPicTable[i].data, dest);
         else
-            LZ77UnCompWram(gMonFrontPicTable[i].data, dest);
+            LZDecompressWram(gMonFrontPicTable[i].data, dest);
     }
     else if (species > NUM_SPECIES) // is species unknown? draw the ? icon
     {
-        LZ77UnCompWram(gMonFrontPicTable[0].data, dest);
+        LZDecompressWram(gMonFrontPicTable[0].data, dest);
     }
     else
     {
-        LZ77UnCompWram(src->data, dest);
+        LZDecompressWram(src->data, dest);
     }
 
     DuplicateDeoxysTiles(dest, species);
@@ -114,7 +249,7 @@ void LoadSpecialPokePic(const struct CompressedSpriteSheet *src, void *dest, s32
 
 void Unused_LZDecompressWramIndirect(const void **src, void *dest)
 {
-    LZ77UnCompWram(*src, dest);
+    LZDecompressWram(*src, dest);
 }
 
 static void UNUSED StitchObjectsOn8x8Canvas(s32 object_size, s32 object_count, u8 *src_tiles, u8 *dest_tiles)
@@ -278,7 +413,7 @@ bool8 LoadCompressedSpriteSheetUsingHeap(const struct CompressedSpriteSheet *src
     void *buffer;
 
     buffer = AllocZeroed(src->data[0] >> 8);
-    LZ77UnCompWram(src->data, buffer);
+    LZDecompressWram(src->data, buffer);
 
     dest.data = buffer;
     dest.size = src->size;
@@ -295,7 +430,7 @@ bool8 LoadCompressedSpritePaletteUsingHeap(const struct CompressedSpritePalette
     void *buffer;
 
     buffer = AllocZeroed(src->data[0] >> 8);
-    LZ77UnCompWram(src->data, buffer);
+    LZDecompressWram(src->data, buffer);
     dest.data = buffer;
     dest.tag = src->tag;
 
@@ -307,9 +442,9 @@ bool8 LoadCompressedSpritePaletteUsingHeap(const struct CompressedSpritePalette
 void DecompressPicFromTable_2(const struct CompressedSpriteSheet *src, void *buffer, s32 species) // a copy of DecompressPicFromTable
 {
     if (species > NUM_SPECIES)
-        LZ77UnCompWram(gMonFrontPicTable[0].data, buffer);
+        LZDecompressWram(gMonFrontPicTable[0].data, buffer);
     else
-        LZ77UnCompWram(src->data, buffer);
+        LZDecompressWram(src->data, buffer);
     DuplicateDeoxysTiles(buffer, species);
 }
 
@@ -326,17 +461,17 @@ void LoadSpecialPokePic_2(const struct CompressedSpriteSheet *src, void *dest, s
             i += SPECIES_UNOWN_B - 1;
 
         if (!isFrontPic)
-            LZ77UnCompWram(gMonBackPicTable[i].data, dest);
+            LZDecompressWram(gMonBackPicTable[i].data, dest);
         else
-            LZ77UnCompWram(gMonFrontPicTable[i].data, dest);
+            LZDecompressWram(gMonFrontPicTable[i].data, dest);
     }
     else if (species > NUM_SPECIES) // is species unknown? draw the ? icon
     {
-        LZ77UnCompWram(gMonFrontPicTable[0].data, dest);
+        LZDecompressWram(gMonFrontPicTable[0].data, dest);
     }
     else
     {
-        LZ77UnCompWram(src->data, dest);
+        LZDecompressWram(src->data, dest);
     }
 
     DuplicateDeoxysTiles(dest, species);
@@ -358,9 +493,9 @@ void HandleLoadSpecialPokePic_2(const struct CompressedSpriteSheet *src, void *d
 void DecompressPicFromTable_DontHandleDeoxys(const struct CompressedSpriteSheet *src, void *buffer, s32 species)
 {
     if (species > NUM_SPECIES)
-        LZ77UnCompWram(gMonFrontPicTable[0].data, buffer);
+        LZDecompressWram(gMonFrontPicTable[0].data, buffer);
     else
-        LZ77UnCompWram(src->data, buffer);
+        LZDecompressWram(src->data, buffer);
 }
 
 void HandleLoadSpecialPokePic_DontHandleDeoxys(const struct CompressedSpriteSheet *src, void *dest, s32 species, u32 personality)
@@ -388,17 +523,17 @@ void LoadSpecialPokePic_DontHandleDeoxys(const struct CompressedSpriteSheet *src
             i += SPECIES_UNOWN_B - 1;
 
         if (!isFrontPic)
-            LZ77UnCompWram(gMonBackPicTable[i].data, dest);
+            LZDecompressWram(gMonBackPicTable[i].data, dest);
         else
-            LZ77UnCompWram(gMonFrontPicTable[i].data, dest);
+            LZDecompressWram(gMonFrontPicTable[i].data, dest);
     }
     else if (species > NUM_SPECIES) // is species unknown? draw the ? icon
     {
-        LZ77UnCompWram(gMonFrontPicTable[0].data, dest);
+        LZDecompressWram(gMonFrontPicTable[0].data, dest);
     }
     else
     {
-        LZ77UnCompWram(src->data, dest);
+        LZDecompressWram(src->data, dest);
     }
 
     DrawSpindaSpots(species, personality, dest, isFrontPic);
@@ -90,6 +90,18 @@ static EWRAM_DATA u8 sCurrentReflectionType = 0;
 static EWRAM_DATA u16 sCurrentSpecialObjectPaletteTag = 0;
 static EWRAM_DATA struct LockedAnimObjectEvents *sLockedAnimObjectEvents = {0};
 
+// Index of which tiles object events occupy, so that looking up an object by position
+// only needs to check the few objects whose current or previous coords hash to that tile.
+// Each bucket is a bitmask of object event ids. Objects found through the index still have
+// their coords checked, so tiles that share a bucket don't need to be told apart here.
+#define OBJECT_EVENT_TILE_BUCKETS 32
+#define OBJECT_EVENT_TILE_BUCKET(x, y) (((x) & 7) | (((y) & 3) << 3))
+
+STATIC_ASSERT(OBJECT_EVENTS_COUNT <= 16, ObjectEventTileBucketsTooSmall);
+
+static EWRAM_DATA u16 sObjectEventTileBuckets[OBJECT_EVENT_TILE_BUCKETS] = {0};
+static EWRAM_DATA u8 sObjectEventTileBucketIds[OBJECT_EVENTS_COUNT][2] = {0}; // Buckets for current and previous coords
+
 static void MoveCoordsInDirection(u32, s16 *, s16 *, s16, s16);
 static bool8 ObjectEventExecSingleMovementAction(struct ObjectEvent *, struct Sprite *);
 static void SetMovementDelay(struct Sprite *, s16);
@@ -136,6 +148,7 @@ static bool8 MovementType_Disguise_Callback(struct ObjectEvent *, struct Sprite
 static bool8 MovementType_Buried_Callback(struct ObjectEvent *, struct Sprite *);
 static void CreateReflectionEffectSprites(void);
 static u8 GetObjectEventIdByLocalId(u8);
+static void UpdateObjectEventTileIndexById(u8);
 static u8 GetObjectEventIdByLocalIdAndMapInternal(u8, u8, u8);
 static bool8 GetAvailableObjectEventId(u16, u8, u8, u8 *);
 static void SetObjectEventDynamicGraphicsId(struct ObjectEvent *);
@@ -1186,6 +1199,7 @@ static void ClearObjectEvent(struct ObjectEvent *objectEvent)
     objectEvent->mapNum = MAP_NUM(MAP_UNDEFINED);
     objectEvent->mapGroup = MAP_GROUP(MAP_UNDEFINED);
     objectEvent->movementActionId = MOVEMENT_ACTION_NONE;
+    UpdateObjectEventTileIndex(objectEvent);
 }
 
 static void ClearAllObjectEvents(void)
@@ -1194,6 +1208,47 @@ static void ClearAllObjectEvents(void)
 
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
         ClearObjectEvent(&gObjectEvents[i]);
+
+    RebuildObjectEventTileIndex();
+}
+
+static void UpdateObjectEventTileIndexById(u8 objectEventId)
+{
+    struct ObjectEvent *objectEvent = &gObjectEvents[objectEventId];
+    u16 mask = 1 << objectEventId;
+
+    sObjectEventTileBuckets[sObjectEventTileBucketIds[objectEventId][0]] &= ~mask;
+    sObjectEventTileBuckets[sObjectEventTileBucketIds[objectEventId][1]] &= ~mask;
+
+    if (objectEvent->active)
+    {
+        sObjectEventTileBucketIds[objectEventId][0] = OBJECT_EVENT_TILE_BUCKET(objectEvent->currentCoords.x, objectEvent->currentCoords.y);
+        sObjectEventTileBucketIds[objectEventId][1] = OBJECT_EVENT_TILE_BUCKET(objectEvent->previousCoords.x, objectEvent->previousCoords.y);
+        sObjectEventTileBuckets[sObjectEventTileBucketIds[objectEventId][0]] |= mask;
+        sObjectEventTileBuckets[sObjectEventTileBucketIds[objectEventId][1]] |= mask;
+    }
+}
+
+// Must be called whenever an object event's coords or active state change.
+void UpdateObjectEventTileIndex(struct ObjectEvent *objectEvent)
+{
+    UpdateObjectEventTileIndexById(objectEvent - gObjectEvents);
+}
+
+// For when all object events have been changed at once, e.g. when loaded from the save block.
+void RebuildObjectEventTileIndex(void)
+{
+    u8 i;
+
+    for (i = 0; i < OBJECT_EVENT_TILE_BUCKETS; i++)
+        sObjectEventTileBuckets[i] = 0;
+
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    {
+        sObjectEventTileBucketIds[i][0] = 0;
+        sObjectEventTileBucketIds[i][1] = 0;
+        UpdateObjectEventTileIndexById(i);
+    }
 }
 
 void ResetObjectEvents(void)
@@ -1251,13 +1306,15 @@ bool8 TryGetObjectEventIdByLocalIdAndMap(u8 localId, u8 mapNum, u8 mapGroupId, u
 u8 GetObjectEventIdByXY(s16 x, s16 y)
 {
     u8 i;
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    u16 candidates = sObjectEventTileBuckets[OBJECT_EVENT_TILE_BUCKET(x, y)];
+
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
-        if (gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
-            break;
+        if ((candidates & 1) && gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
+            return i;
     }
 
-    return i;
+    return OBJECT_EVENTS_COUNT;
 }
 
 static u8 GetObjectEventIdByLocalIdAndMapInternal(u8 localId, u8 mapNum, u8 mapGroupId)
@@ -1310,6 +1367,7 @@ static u8 InitObjectEventStateFromTemplate(const struct ObjectEventTemplate *tem
     objectEvent->currentCoords.y = y;
     objectEvent->previousCoords.x = x;
     objectEvent->previousCoords.y = y;
+    UpdateObjectEventTileIndex(objectEvent);
     objectEvent->currentElevation = template->elevation;
     objectEvent->previousElevation = template->elevation;
     objectEvent->range.rangeX = template->movementRangeX;
@@ -1383,6 +1441,7 @@ static bool8 GetAvailableObjectEventId(u16 localId, u8 mapNum, u8 mapGroup, u8 *
 static void RemoveObjectEvent(struct ObjectEvent *objectEvent)
 {
     objectEvent->active = FALSE;
+    UpdateObjectEventTileIndex(objectEvent);
     RemoveObjectEventInternal(objectEvent);
 }
 
@@ -1453,6 +1512,7 @@ static u8 TrySetupObjectEventSprite(const struct ObjectEventTemplate *objectEven
     if (spriteId == MAX_SPRITES)
     {
         gObjectEvents[objectEventId].active = FALSE;
+        UpdateObjectEventTileIndexById(objectEventId);
         return OBJECT_EVENTS_COUNT;
     }
 
@@ -2112,6 +2172,7 @@ static void UNUSED IncrementObjectEventCoords(struct ObjectEvent *objectEvent, s
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x += x;
     objectEvent->currentCoords.y += y;
+    UpdateObjectEventTileIndex(objectEvent);
 }
 
 void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2120,6 +2181,7 @@ void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+    UpdateObjectEventTileIndex(objectEvent);
 }
 
 static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2128,6 +2190,7 @@ static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+    UpdateObjectEventTileIndex(objectEvent);
 }
 
 void MoveObjectEventToMapCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2186,16 +2249,18 @@ void UpdateObjectEventCoordsForCameraUpdate(void)
                 gObjectEvents[i].previousCoords.y -= dy;
             }
         }
+        RebuildObjectEventTileIndex();
     }
 }
 
 u8 GetObjectEventIdByPosition(u16 x, u16 y, u8 elevation)
 {
     u8 i;
+    u16 candidates = sObjectEventTileBuckets[OBJECT_EVENT_TILE_BUCKET(x, y)];
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
-        if (gObjectEvents[i].active)
+        if ((candidates & 1) && gObjectEvents[i].active)
         {
             if (gObjectEvents[i].currentCoords.x == x
              && gObjectEvents[i].currentCoords.y == y
@@ -4725,11 +4790,12 @@ static bool8 DoesObjectCollideWithObjectAt(struct ObjectEvent *objectEvent, s16
 {
     u8 i;
     struct ObjectEvent *curObject;
+    u16 candidates = sObjectEventTileBuckets[OBJECT_EVENT_TILE_BUCKET(x, y)];
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
         curObject = &gObjectEvents[i];
-        if (curObject->active && curObject != objectEvent)
+        if ((candidates & 1) && curObject->active && curObject != objectEvent)
         {
             if ((curObject->currentCoords.x == x && curObject->currentCoords.y == y) || (curObject->previousCoords.x == x && curObject->previousCoords.y == y))
             {
@@ -962,6 +962,7 @@ void MultiplyInvertedPaletteRGBComponents(u16 i, u8 r, u8 g, u8 b)
     color |= (curBlue  << 10);
 
     gPlttBufferFaded[i] = color;
+    MarkPaletteRangeDirty(i, 1);
 }
 
 // r, g, b are between 0 and 16
@@ -983,6 +984,7 @@ void MultiplyPaletteRGBComponents(u16 i, u8 r, u8 g, u8 b)
     color |= (curBlue  << 10);
 
     gPlttBufferFaded[i] = color;
+    MarkPaletteRangeDirty(i, 1);
 }
 
 // Task data for Task_PokecenterHeal and Task_HallOfFameRecord
@@ -463,6 +463,8 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
     u8 *colorMap;
     u16 i;
 
+    MarkPaletteRangeDirty(PLTT_ID(startPalIndex), PLTT_ID(numPalettes));
+
     if (colorMapIndex > 0)
     {
         colorMapIndex--;
@@ -542,11 +544,9 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
     u16 palOffset;
     u16 curPalIndex;
     u16 i;
-    struct RGBColor color = *(struct RGBColor *)&blendColor;
-    u8 rBlend = color.r;
-    u8 gBlend = color.g;
-    u8 bBlend = color.b;
+    u32 mappedColors[16 / 2]; // Word-aligned for BlendColors
 
+    MarkPaletteRangeDirty(PLTT_ID(startPalIndex), PLTT_ID(numPalettes));
     palOffset = PLTT_ID(startPalIndex);
     numPalettes += startPalIndex;
     colorMapIndex--;
@@ -569,19 +569,19 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
             else
                 colorMap = gWeatherPtr->contrastColorMaps[colorMapIndex];
 
+            // Apply color map to the original color.
             for (i = 0; i < 16; i++)
             {
-                struct RGBColor baseColor = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
+                struct RGBColor baseColor = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset + i];
                 u8 r = colorMap[baseColor.r];
                 u8 g = colorMap[baseColor.g];
                 u8 b = colorMap[baseColor.b];
-
-                // Apply color map and target blend color to the original color.
-                r += ((rBlend - r) * blendCoeff) >> 4;
-                g += ((gBlend - g) * blendCoeff) >> 4;
-                b += ((bBlend - b) * blendCoeff) >> 4;
-                gPlttBufferFaded[palOffset++] = RGB2(r, g, b);
+                ((u16 *)mappedColors)[i] = RGB2(r, g, b);
             }
+
+            // Apply target blend color to the mapped colors.
+            BlendColors((u16 *)mappedColors, &gPlttBufferFaded[palOffset], 16, blendCoeff, blendColor);
+            palOffset += 16;
         }
 
         curPalIndex++;
@@ -590,19 +590,13 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
 
 static void ApplyDroughtColorMapWithBlend(s8 colorMapIndex, u8 blendCoeff, u16 blendColor)
 {
-    struct RGBColor color;
-    u8 rBlend;
-    u8 gBlend;
-    u8 bBlend;
     u16 curPalIndex;
     u16 palOffset;
     u16 i;
+    u32 mappedColors[16 / 2]; // Word-aligned for BlendColors
 
+    MarkPalettesDirty(PALETTES_ALL);
     colorMapIndex = -colorMapIndex - 1;
-    color = *(struct RGBColor *)&blendColor;
-    rBlend = color.r;
-    gBlend = color.g;
-    bBlend = color.b;
     palOffset = 0;
     for (curPalIndex = 0; curPalIndex < 32; curPalIndex++)
     {
@@ -618,70 +612,39 @@ static void ApplyDroughtColorMapWithBlend(s8 colorMapIndex, u8 blendCoeff, u16 b
             {
                 u32 offset;
                 struct RGBColor color1;
-                struct RGBColor color2;
                 u8 r1, g1, b1;
-                u8 r2, g2, b2;
 
-                color1 = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
+                color1 = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset + i];
                 r1 = color1.r;
                 g1 = color1.g;
                 b1 = color1.b;
 
                 offset = ((b1 & 0x1E) << 7) | ((g1 & 0x1E) << 3) | ((r1 & 0x1E) >> 1);
-                color2 = *(struct RGBColor *)&sDroughtWeatherColors[colorMapIndex][offset];
-                r2 = color2.r;
-                g2 = color2.g;
-                b2 = color2.b;
-
-                r2 += ((rBlend - r2) * blendCoeff) >> 4;
-                g2 += ((gBlend - g2) * blendCoeff) >> 4;
-                b2 += ((bBlend - b2) * blendCoeff) >> 4;
-
-                gPlttBufferFaded[palOffset++] = RGB2(r2, g2, b2);
+                ((u16 *)mappedColors)[i] = sDroughtWeatherColors[colorMapIndex][offset];
             }
+
+            BlendColors((u16 *)mappedColors, &gPlttBufferFaded[palOffset], 16, blendCoeff, blendColor);
+            palOffset += 16;
         }
     }
 }
 
 static void ApplyFogBlend(u8 blendCoeff, u16 blendColor)
 {
-    struct RGBColor color;
-    u8 rBlend;
-    u8 gBlend;
-    u8 bBlend;
     u16 curPalIndex;
+    u32 lightenedColors[16 / 2]; // Word-aligned for BlendColors
 
     BlendPalette(BG_PLTT_ID(0), 16 * 16, blendCoeff, blendColor);
-    color = *(struct RGBColor *)&blendColor;
-    rBlend = color.r;
-    gBlend = color.g;
-    bBlend = color.b;
+    MarkPalettesDirty(PALETTES_OBJECTS);
 
     for (curPalIndex = 16; curPalIndex < 32; curPalIndex++)
     {
         if (LightenSpritePaletteInFog(curPalIndex))
         {
-            u16 palEnd = PLTT_ID(curPalIndex + 1);
-            u16 palOffset = PLTT_ID(curPalIndex);
-
-            while (palOffset < palEnd)
-            {
-                struct RGBColor color = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
-                u8 r = color.r;
-                u8 g = color.g;
-                u8 b = color.b;
-
-                r += ((28 - r) * 3) >> 2;
-                g += ((31 - g) * 3) >> 2;
-                b += ((28 - b) * 3) >> 2;
-
-                r += ((rBlend - r) * blendCoeff) >> 4;
-                g += ((gBlend - g) * blendCoeff) >> 4;
-                b += ((bBlend - b) * blendCoeff) >> 4;
-
-                gPlttBufferFaded[palOffset] = RGB2(r, g, b);
-                palOffset++;
-            }
+            // Lighten the sprite palette 3/4 of the way towards RGB(28, 31, 28),
+            // then blend it like the others.
+            BlendColors(&gPlttBufferUnfaded[PLTT_ID(curPalIndex)], (u16 *)lightenedColors, 16, 12, RGB(28, 31, 28));
+            BlendColors((u16 *)lightenedColors, &gPlttBufferFaded[PLTT_ID(curPalIndex)], 16, blendCoeff, blendColor);
         }
         else
         {
@@ -822,6 +785,7 @@ void UpdateSpritePaletteWithWeather(u8 spritePaletteIndex)
             paletteIndex = PLTT_ID(paletteIndex);
             for (i = 0; i < 16; i++)
                 gPlttBufferFaded[paletteIndex + i] = gWeatherPtr->fadeDestColor;
+            MarkPaletteRangeDirty(paletteIndex, 16);
         }
         break;
     case WEATHER_PAL_STATE_SCREEN_FADING_OUT:
@@ -29,6 +29,11 @@ EWRAM_DATA static u16 ALIGNED(4) sBackupMapData[MAX_MAP_DATA_SIZE] = {0};
 EWRAM_DATA struct MapHeader gMapHeader = {0};
 EWRAM_DATA struct Camera gCamera = {0};
 EWRAM_DATA static struct ConnectionFlags sMapConnectionFlags = {0};
+// The tilesets whose tiles are in BG VRAM. Warping between maps that share a tileset
+// (e.g. in and out of a building) can leave its tiles there instead of loading them again.
+EWRAM_DATA static struct Tileset const *sPrimaryTilesetInVram = NULL;
+EWRAM_DATA static struct Tileset const *sSecondaryTilesetInVram = NULL;
+EWRAM_DATA static bool8 sReuseTilesetsInVram = FALSE;
 EWRAM_DATA static u32 UNUSED sFiller = 0; // without this, the next file won't align properly
 
 COMMON_DATA struct BackupMapLayout gBackupMapLayout = {0};
@@ -899,17 +904,29 @@ static void LoadTilesetPalette(struct Tileset const *tileset, u16 destOffset, u1
 
 void CopyPrimaryTilesetToVram(struct MapLayout const *mapLayout)
 {
-    CopyTilesetToVram(mapLayout->primaryTileset, NUM_TILES_IN_PRIMARY, 0);
+    if (mapLayout->primaryTileset != sPrimaryTilesetInVram)
+    {
+        CopyTilesetToVram(mapLayout->primaryTileset, NUM_TILES_IN_PRIMARY, 0);
+        sPrimaryTilesetInVram = mapLayout->primaryTileset;
+    }
 }
 
 void CopySecondaryTilesetToVram(struct MapLayout const *mapLayout)
 {
-    CopyTilesetToVram(mapLayout->secondaryTileset, NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY, NUM_TILES_IN_PRIMARY);
+    if (mapLayout->secondaryTileset != sSecondaryTilesetInVram)
+    {
+        CopyTilesetToVram(mapLayout->secondaryTileset, NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY, NUM_TILES_IN_PRIMARY);
+        sSecondaryTilesetInVram = mapLayout->secondaryTileset;
+    }
 }
 
 void CopySecondaryTilesetToVramUsingHeap(struct MapLayout const *mapLayout)
 {
-    CopyTilesetToVramUsingHeap(mapLayout->secondaryTileset, NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY, NUM_TILES_IN_PRIMARY);
+    if (mapLayout->secondaryTileset != sSecondaryTilesetInVram)
+    {
+        CopyTilesetToVramUsingHeap(mapLayout->secondaryTileset, NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY, NUM_TILES_IN_PRIMARY);
+        sSecondaryTilesetInVram = mapLayout->secondaryTileset;
+    }
 }
 
 static void LoadPrimaryTilesetPalette(struct MapLayout const *mapLayout)
@@ -926,9 +943,49 @@ void CopyMapTilesetsToVram(struct MapLayout const *mapLayout)
 {
     if (mapLayout)
     {
-        CopyTilesetToVramUsingHeap(mapLayout->primaryTileset, NUM_TILES_IN_PRIMARY, 0);
-        CopyTilesetToVramUsingHeap(mapLayout->secondaryTileset, NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY, NUM_TILES_IN_PRIMARY);
+        if (mapLayout->primaryTileset != sPrimaryTilesetInVram)
+        {
+            CopyTilesetToVramUsingHeap(mapLayout->primaryTileset, NUM_TILES_IN_PRIMARY, 0);
+            sPrimaryTilesetInVram = mapLayout->primaryTileset;
+        }
+        CopySecondaryTilesetToVramUsingHeap(mapLayout);
+    }
+}
+
+// Whether the next map load may keep tileset tiles that are already in VRAM. This
+// is only safe when nothing but the overworld has used VRAM since they were loaded.
+void SetReuseMapTilesetsInVram(bool8 reuse)
+{
+    sReuseTilesetsInVram = reuse;
+}
+
+void ForgetMapTilesetsInVram(void)
+{
+    sPrimaryTilesetInVram = NULL;
+    sSecondaryTilesetInVram = NULL;
+}
+
+// Clears VRAM to load the current map. The tiles of a tileset that's in VRAM
+// and used by the new map are kept if allowed by SetReuseMapTilesetsInVram.
+// The tilesets are loaded into BG 2's tiles, which start at the beginning of VRAM.
+void ClearVramForMapLoad(void)
+{
+    struct MapLayout const *mapLayout = gMapHeader.mapLayout;
+
+    if (!sReuseTilesetsInVram || mapLayout == NULL)
+        ForgetMapTilesetsInVram();
+
+    if (sPrimaryTilesetInVram == NULL || sPrimaryTilesetInVram != mapLayout->primaryTileset)
+    {
+        sPrimaryTilesetInVram = NULL;
+        DmaFillLarge16(3, 0, (void *)VRAM, NUM_TILES_IN_PRIMARY * TILE_SIZE_4BPP, 0x1000);
+    }
+    if (sSecondaryTilesetInVram == NULL || sSecondaryTilesetInVram != mapLayout->secondaryTileset)
+    {
+        sSecondaryTilesetInVram = NULL;
+        DmaFillLarge16(3, 0, (void *)(VRAM + NUM_TILES_IN_PRIMARY * TILE_SIZE_4BPP), (NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY) * TILE_SIZE_4BPP, 0x1000);
     }
+    DmaFillLarge16(3, 0, (void *)(VRAM + NUM_TILES_TOTAL * TILE_SIZE_4BPP), VRAM_SIZE - NUM_TILES_TOTAL * TILE_SIZE_4BPP, 0x1000);
 }
 
 void LoadMapTilesetPalettes(struct MapLayout const *mapLayout)
@@ -388,6 +388,7 @@ static void Task_ComputerScreenOpenEffect(u8 taskId)
             SetGpuReg(REG_OFFSET_BLDCNT, task->tBlendCnt);
             BlendPalettes(PALETTES_ALL, 0, 0);
             gPlttBufferFaded[0] = 0;
+            MarkPaletteRangeDirty(0, 1);
         }
         SetGpuReg(REG_OFFSET_WIN0H, WIN_RANGE(task->tWinLeft, task->tWinRight));
 
@@ -425,6 +426,7 @@ static void Task_ComputerScreenCloseEffect(u8 taskId)
     {
     case 0:
         gPlttBufferFaded[0] = 0;
+        MarkPaletteRangeDirty(0, 1);
         break;
     case 1:
         task->tWinLeft = 0;
@@ -464,6 +466,7 @@ static void Task_ComputerScreenCloseEffect(u8 taskId)
             task->tWinRight = DISPLAY_WIDTH / 2;
             BlendPalettes(PALETTES_ALL, 16, 0);
             gPlttBufferFaded[0] = 0;
+            MarkPaletteRangeDirty(0, 1);
         }
         SetGpuReg(REG_OFFSET_WIN0H, WIN_RANGE(task->tWinLeft, task->tWinRight));
 
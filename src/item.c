@@ -20,9 +20,54 @@ static bool8 CheckPyramidBagHasSpace(u16 itemId, u16 count);
 
 EWRAM_DATA struct BagPocket gBagPockets[POCKETS_COUNT] = {0};
 
+// The first slot holding each item in its bag pocket, so that the bag functions
+// don't have to search a whole pocket for an item. It's only kept in RAM, and a
+// pocket's entries are rebuilt the next time they're used after anything moves,
+// adds or removes item slots in it. Entries for items that aren't in the bag are
+// left stale and are caught by checking the slot's item ID.
+EWRAM_DATA static u8 sBagItemFirstSlot[ITEMS_COUNT] = {0};
+EWRAM_DATA static u8 sBagItemIndexValidPockets = 0;
+
 #include "data/text/item_descriptions.h"
 #include "data/items.h"
 
+void InvalidateBagItemIndex(void)
+{
+    sBagItemIndexValidPockets = 0;
+}
+
+static void InvalidateBagPocketItemIndex(u8 pocket)
+{
+    sBagItemIndexValidPockets &= ~(1 << pocket);
+}
+
+// Returns the first slot in the item's pocket that holds it, or -1 if there isn't one.
+static s32 FindBagItemFirstSlot(u8 pocket, u16 itemId)
+{
+    struct BagPocket *bagPocket = &gBagPockets[pocket];
+    s32 i;
+    u16 slotItemId;
+
+    if (itemId >= ITEMS_COUNT)
+        return -1;
+
+    if (!(sBagItemIndexValidPockets & (1 << pocket)))
+    {
+        for (i = bagPocket->capacity - 1; i >= 0; i--)
+        {
+            slotItemId = bagPocket->itemSlots[i].itemId;
+            if (slotItemId != ITEM_NONE && slotItemId < ITEMS_COUNT && GetItemPocket(slotItemId) - 1 == pocket)
+                sBagItemFirstSlot[slotItemId] = i;
+        }
+        sBagItemIndexValidPockets |= 1 << pocket;
+    }
+
+    i = sBagItemFirstSlot[itemId];
+    if (i < bagPocket->capacity && bagPocket->itemSlots[i].itemId == itemId)
+        return i;
+    return -1;
+}
+
 static u16 GetBagItemQuantity(u16 *quantity)
 {
     return gSaveBlock2Ptr->encryptionKey ^ *quantity;
@@ -60,6 +105,8 @@ void ApplyNewEncryptionKeyToBagItems_(u32 newKey) // really GF?
 
 void SetBagItemsPointers(void)
 {
+    InvalidateBagItemIndex();
+
     gBagPockets[ITEMS_POCKET].itemSlots = gSaveBlock1Ptr->bagPocket_Items;
     gBagPockets[ITEMS_POCKET].capacity = BAG_ITEMS_COUNT;
 
@@ -128,7 +175,7 @@ bool8 IsBagPocketNonEmpty(u8 pocket)
 
 bool8 CheckBagHasItem(u16 itemId, u16 count)
 {
-    u8 i;
+    s32 i;
     u8 pocket;
 
     if (GetItemPocket(itemId) == 0)
@@ -136,8 +183,11 @@ bool8 CheckBagHasItem(u16 itemId, u16 count)
     if (CurrentBattlePyramidLocation() != PYRAMID_LOCATION_NONE || FlagGet(FLAG_STORING_ITEMS_IN_PYRAMID_BAG) == TRUE)
         return CheckPyramidBagHasItem(itemId, count);
     pocket = GetItemPocket(itemId) - 1;
+    i = FindBagItemFirstSlot(pocket, itemId);
+    if (i < 0)
+        return FALSE;
     // Check for item slots that contain the item
-    for (i = 0; i < gBagPockets[pocket].capacity; i++)
+    for (; i < gBagPockets[pocket].capacity; i++)
     {
         if (gBagPockets[pocket].itemSlots[i].itemId == itemId)
         {
@@ -173,7 +223,7 @@ bool8 HasAtLeastOneBerry(void)
 
 bool8 CheckBagHasSpace(u16 itemId, u16 count)
 {
-    u8 i;
+    s32 i;
     u8 pocket;
     u16 slotCapacity;
     u16 ownedCount;
@@ -193,7 +243,8 @@ bool8 CheckBagHasSpace(u16 itemId, u16 count)
         slotCapacity = MAX_BERRY_CAPACITY;
 
     // Check space in any existing item slots that already contain this item
-    for (i = 0; i < gBagPockets[pocket].capacity; i++)
+    i = FindBagItemFirstSlot(pocket, itemId);
+    for (; i >= 0 && i < gBagPockets[pocket].capacity; i++)
     {
         if (gBagPockets[pocket].itemSlots[i].itemId == itemId)
         {
@@ -237,7 +288,7 @@ bool8 CheckBagHasSpace(u16 itemId, u16 count)
 
 bool8 AddBagItem(u16 itemId, u16 count)
 {
-    u8 i;
+    s32 i;
 
     if (GetItemPocket(itemId) == POCKET_NONE)
         return FALSE;
@@ -264,7 +315,8 @@ bool8 AddBagItem(u16 itemId, u16 count)
         else
             slotCapacity = MAX_BERRY_CAPACITY;
 
-        for (i = 0; i < itemPocket->capacity; i++)
+        i = FindBagItemFirstSlot(pocket, itemId);
+        for (; i >= 0 && i < itemPocket->capacity; i++)
         {
             if (newItems[i].itemId == itemId)
             {
@@ -335,6 +387,7 @@ bool8 AddBagItem(u16 itemId, u16 count)
                 Free(newItems);
                 return FALSE;
             }
+            InvalidateBagPocketItemIndex(pocket);
         }
         memcpy(itemPocket->itemSlots, newItems, itemPocket->capacity * sizeof(struct ItemSlot));
         Free(newItems);
@@ -344,7 +397,8 @@ bool8 AddBagItem(u16 itemId, u16 count)
 
 bool8 RemoveBagItem(u16 itemId, u16 count)
 {
-    u8 i;
+    s32 i;
+    s32 firstSlot;
     u16 totalQuantity = 0;
 
     if (GetItemPocket(itemId) == POCKET_NONE || itemId == ITEM_NONE)
@@ -365,7 +419,8 @@ bool8 RemoveBagItem(u16 itemId, u16 count)
         pocket = GetItemPocket(itemId) - 1;
         itemPocket = &gBagPockets[pocket];
 
-        for (i = 0; i < itemPocket->capacity; i++)
+        firstSlot = FindBagItemFirstSlot(pocket, itemId);
+        for (i = firstSlot; i >= 0 && i < itemPocket->capacity; i++)
         {
             if (itemPocket->itemSlots[i].itemId == itemId)
                 totalQuantity += GetBagItemQuantity(&itemPocket->itemSlots[i].quantity);
@@ -397,13 +452,16 @@ bool8 RemoveBagItem(u16 itemId, u16 count)
             }
 
             if (GetBagItemQuantity(&itemPocket->itemSlots[var].quantity) == 0)
+            {
                 itemPocket->itemSlots[var].itemId = ITEM_NONE;
+                InvalidateBagPocketItemIndex(pocket);
+            }
 
             if (count == 0)
                 return TRUE;
         }
 
-        for (i = 0; i < itemPocket->capacity; i++)
+        for (i = firstSlot; i >= 0 && i < itemPocket->capacity; i++)
         {
             if (itemPocket->itemSlots[i].itemId == itemId)
             {
@@ -420,7 +478,10 @@ bool8 RemoveBagItem(u16 itemId, u16 count)
                 }
 
                 if (GetBagItemQuantity(&itemPocket->itemSlots[i].quantity) == 0)
+                {
                     itemPocket->itemSlots[i].itemId = ITEM_NONE;
+                    InvalidateBagPocketItemIndex(pocket);
+                }
 
                 if (count == 0)
                     return TRUE;
@@ -439,6 +500,8 @@ void ClearItemSlots(struct ItemSlot *itemSlots, u8 itemCount)
 {
     u16 i;
 
+    InvalidateBagItemIndex();
+
     for (i = 0; i < itemCount; i++)
     {
         itemSlots[i].itemId = ITEM_NONE;
@@ -602,6 +665,8 @@ void CompactItemsInBagPocket(struct BagPocket *bagPocket)
 {
     u16 i, j;
 
+    InvalidateBagItemIndex();
+
     for (i = 0; i < bagPocket->capacity - 1; i++)
     {
         for (j = i + 1; j < bagPocket->capacity; j++)
@@ -616,6 +681,8 @@ void SortBerriesOrTMHMs(struct BagPocket *bagPocket)
 {
     u16 i, j;
 
+    InvalidateBagItemIndex();
+
     for (i = 0; i < bagPocket->capacity - 1; i++)
     {
         for (j = i + 1; j < bagPocket->capacity; j++)
@@ -643,6 +710,8 @@ void MoveItemSlotInList(struct ItemSlot *itemSlots_, u32 from, u32 to_)
         s16 i, count;
         struct ItemSlot firstSlot = itemSlots[from];
 
+        InvalidateBagItemIndex();
+
         if (to > from)
         {
             to--;
@@ -670,11 +739,16 @@ void ClearBag(void)
 
 u16 CountTotalItemQuantityInBag(u16 itemId)
 {
-    u16 i;
+    s32 i;
     u16 ownedCount = 0;
-    struct BagPocket *bagPocket = &gBagPockets[GetItemPocket(itemId) - 1];
+    u8 pocket = GetItemPocket(itemId) - 1;
+    struct BagPocket *bagPocket = &gBagPockets[pocket];
+
+    if (pocket >= POCKETS_COUNT)
+        return 0;
 
-    for (i = 0; i < bagPocket->capacity; i++)
+    i = FindBagItemFirstSlot(pocket, itemId);
+    for (; i >= 0 && i < bagPocket->capacity; i++)
     {
         if (bagPocket->itemSlots[i].itemId == itemId)
             ownedCount += GetBagItemQuantity(&bagPocket->itemSlots[i].quantity);
@@ -28,6 +28,21 @@
 #include "constants/rgb.h"
 #include "constants/trade.h"
 
+// Set to FALSE to always send blocks over the cable link uncompressed.
+#define COMPRESS_LINK_BLOCKS TRUE
+
+// Sent in the 4th word of LINKCMD_INIT_BLOCK by games that can receive compressed
+// blocks. Other games leave it as 0, so a block is only compressed once every player
+// has sent one of these, which they all do when exchanging their link player data.
+#define BLOCK_LZ_SUPPORTED  0x4C5A
+#define BLOCK_LZ_COMPRESSED 0x4C5B
+
+#define BLOCK_BYTES_PER_CMD ((CMD_LENGTH - 1) * 2)
+
+// Compressed blocks are sent in the BIOS LZ77 format. They're never larger than
+// BLOCK_BUFFER_SIZE, but are received a whole command at a time.
+#define COMPRESSED_BLOCK_BUFFER_SIZE (BLOCK_BUFFER_SIZE + 16)
+
 // Window IDs for the link error screens
 enum {
     WIN_LINK_ERROR_TOP,
@@ -42,6 +57,7 @@ struct BlockTransfer
     const u8 *src;
     bool8 active;
     u8 multiplayerId;
+    bool8 compressed;
 };
 
 struct LinkTestBGInfo
@@ -67,6 +83,7 @@ static u16 sSendNonzeroCheck;
 static u16 sRecvNonzeroCheck;
 static u8 sChecksumAvailable;
 static u8 sHandshakePlayerCount;
+static u8 sBlockCompressionPlayers;
 
 COMMON_DATA u16 gLinkPartnersHeldKeys[6] = {0};
 COMMON_DATA u32 gLinkDebugSeed = 0;
@@ -123,6 +140,10 @@ static EWRAM_DATA struct {
 } sLinkErrorBuffer = {};
 static EWRAM_DATA u16 sReadyCloseLinkAttempts = 0; // never read
 static EWRAM_DATA void *sLinkErrorBgTilemapBuffer = NULL;
+static EWRAM_DATA u32 sBlockSendCompressed[COMPRESSED_BLOCK_BUFFER_SIZE / 4] = {};
+static EWRAM_DATA u32 sBlockRecvCompressed[MAX_LINK_PLAYERS][COMPRESSED_BLOCK_BUFFER_SIZE / 4] = {};
+static EWRAM_DATA u16 sBlockLZHashHeads[256] = {};
+static EWRAM_DATA u8 sBlockLZHashPrevDist[BLOCK_BUFFER_SIZE] = {};
 
 static void InitLocalLinkPlayer(void);
 static void VBlankCB_LinkError(void);
@@ -134,6 +155,7 @@ static bool32 InitBlockSend(const void *, size_t);
 static void LinkCB_BlockSendBegin(void);
 static void LinkCB_BlockSend(void);
 static void LinkCB_BlockSendEnd(void);
+static u16 CompressBlock(const u8 *, u16, u8 *);
 static void SetBlockReceivedFlag(u8);
 static u16 LinkTestCalcBlockChecksum(const u16 *, u16);
 static void LinkTest_PrintHex(u32, u8, u8, u8);
@@ -378,6 +400,7 @@ void OpenLink(void)
         gSuppressLinkErrorMessage = FALSE;
         ResetBlockReceivedFlags();
         ResetBlockSend();
+        sBlockCompressionPlayers = 0;
         sDummy1 = FALSE;
         gLinkDummy2 = FALSE;
         gLinkDummy1 = FALSE;
@@ -565,11 +588,35 @@ static void ProcessRecvCmds(u8 unused)
                 blockRecv->pos = 0;
                 blockRecv->size = gRecvCmds[i][1];
                 blockRecv->multiplayerId = gRecvCmds[i][2];
+                blockRecv->compressed = (gRecvCmds[i][3] == BLOCK_LZ_COMPRESSED);
+                if (blockRecv->compressed && blockRecv->size > COMPRESSED_BLOCK_BUFFER_SIZE)
+                {
+                    SetMainCallback2(CB2_LinkError);
+                    break;
+                }
+                if (gRecvCmds[i][3] == BLOCK_LZ_SUPPORTED || gRecvCmds[i][3] == BLOCK_LZ_COMPRESSED)
+                    sBlockCompressionPlayers |= 1 << i;
+                else
+                    sBlockCompressionPlayers &= ~(1 << i);
                 break;
             }
             case LINKCMD_CONT_BLOCK:
             {
-                if (sBlockRecv[i].size > BLOCK_BUFFER_SIZE)
+                if (sBlockRecv[i].compressed)
+                {
+                    u16 *buffer;
+                    u16 j;
+
+                    // The last packet of a block can run past the end of the buffer,
+                    // but only with data that's past the end of the block
+                    buffer = (u16 *)sBlockRecvCompressed[i];
+                    for (j = 0; j < CMD_LENGTH - 1; j++)
+                    {
+                        if ((sBlockRecv[i].pos / 2) + j < COMPRESSED_BLOCK_BUFFER_SIZE / 2)
+                            buffer[(sBlockRecv[i].pos / 2) + j] = gRecvCmds[i][j + 1];
+                    }
+                }
+                else if (sBlockRecv[i].size > BLOCK_BUFFER_SIZE)
                 {
                     u16 *buffer;
                     u16 j;
@@ -594,6 +641,20 @@ static void ProcessRecvCmds(u8 unused)
 
                 if (sBlockRecv[i].pos >= sBlockRecv[i].size)
                 {
+                    if (sBlockRecv[i].compressed)
+                    {
+                        // The header holds the type and the uncompressed size
+                        u32 header = sBlockRecvCompressed[i][0];
+
+                        if ((header & 0xFF) != 0x10 || (header >> 8) > BLOCK_BUFFER_SIZE)
+                        {
+                            SetMainCallback2(CB2_LinkError);
+                            break;
+                        }
+                        LZ77UnCompWram(sBlockRecvCompressed[i], gBlockRecvBuffer[i]);
+                        sBlockRecv[i].size = header >> 8;
+                        sBlockRecv[i].compressed = FALSE;
+                    }
                     if (gRemoteLinkPlayersNotReceived[i] == TRUE)
                     {
                         struct LinkPlayerBlock *block;
@@ -679,6 +740,8 @@ static void BuildSendCmd(u16 command)
             gSendCmd[0] = LINKCMD_INIT_BLOCK;
             gSendCmd[1] = sBlockSend.size;
             gSendCmd[2] = sBlockSend.multiplayerId + 0x80;
+            if (COMPRESS_LINK_BLOCKS)
+                gSendCmd[3] = sBlockSend.compressed ? BLOCK_LZ_COMPRESSED : BLOCK_LZ_SUPPORTED;
             break;
         case LINKCMD_BLENDER_NO_PBLOCK_SPACE:
             gSendCmd[0] = LINKCMD_BLENDER_NO_PBLOCK_SPACE;
@@ -936,8 +999,20 @@ static void ResetBlockSend(void)
     sBlockSend.src = NULL;
 }
 
+static bool8 CanSendCompressedBlocks(void)
+{
+    u8 allPlayers = (1 << GetLinkPlayerCount()) - 1;
+
+    if (!COMPRESS_LINK_BLOCKS || !gReceivedRemoteLinkPlayers)
+        return FALSE;
+
+    return (sBlockCompressionPlayers & allPlayers) == allPlayers;
+}
+
 static bool32 InitBlockSend(const void *src, size_t size)
 {
+    u16 compressedSize;
+
     if (sBlockSend.active)
     {
         return FALSE;
@@ -946,6 +1021,7 @@ static bool32 InitBlockSend(const void *src, size_t size)
     sBlockSend.active = TRUE;
     sBlockSend.size = size;
     sBlockSend.pos = 0;
+    sBlockSend.compressed = FALSE;
     if (size > BLOCK_BUFFER_SIZE)
     {
         sBlockSend.src = src;
@@ -956,6 +1032,19 @@ static bool32 InitBlockSend(const void *src, size_t size)
             memcpy(gBlockSendBuffer, src, size);
 
         sBlockSend.src = gBlockSendBuffer;
+
+        // Only send the block compressed if it takes fewer commands to do so
+        if (CanSendCompressedBlocks())
+        {
+            compressedSize = CompressBlock(gBlockSendBuffer, size, (u8 *)sBlockSendCompressed);
+            if (compressedSize != 0
+             && (compressedSize + BLOCK_BYTES_PER_CMD - 1) / BLOCK_BYTES_PER_CMD < (size + BLOCK_BYTES_PER_CMD - 1) / BLOCK_BYTES_PER_CMD)
+            {
+                sBlockSend.src = (const u8 *)sBlockSendCompressed;
+                sBlockSend.size = compressedSize;
+                sBlockSend.compressed = TRUE;
+            }
+        }
     }
     BuildSendCmd(LINKCMD_INIT_BLOCK);
     gLinkCallback = LinkCB_BlockSendBegin;
@@ -993,6 +1082,103 @@ static void LinkCB_BlockSendEnd(void)
     gLinkCallback = NULL;
 }
 
+#define BLOCK_LZ_HASH(p) (((p)[0] ^ ((p)[1] << 3) ^ ((p)[1] >> 5) ^ ((p)[2] << 6) ^ ((p)[2] >> 2)) & 0xFF)
+#define BLOCK_LZ_MAX_CHAIN 16
+
+// Each hash head holds the last position with that hash + 1, or 0 if there isn't one,
+// and each position holds the distance back to the previous one with the same hash.
+static void InsertBlockLZHash(const u8 *src, u16 pos)
+{
+    u8 hash = BLOCK_LZ_HASH(&src[pos]);
+
+    if (sBlockLZHashHeads[hash] != 0)
+        sBlockLZHashPrevDist[pos] = pos - (sBlockLZHashHeads[hash] - 1);
+    else
+        sBlockLZHashPrevDist[pos] = 0;
+    sBlockLZHashHeads[hash] = pos + 1;
+}
+
+// Compresses a block of at most BLOCK_BUFFER_SIZE bytes into the format read by
+// LZ77UnCompWram. Returns the compressed size, or 0 if it wouldn't be any smaller.
+static u16 CompressBlock(const u8 *src, u16 size, u8 *dest)
+{
+    s32 candidate;
+    u16 srcPos, destPos, flagsPos, len, bestLen, bestDist, chain;
+    u8 flag;
+
+    dest[0] = 0x10;
+    dest[1] = size;
+    dest[2] = size >> 8;
+    dest[3] = 0;
+    destPos = 4;
+    flagsPos = 0;
+    flag = 0;
+    srcPos = 0;
+    CpuFill16(0, sBlockLZHashHeads, sizeof(sBlockLZHashHeads));
+
+    while (srcPos < size)
+    {
+        // A flags byte and a match is the most that can be written this iteration
+        if (destPos + 3 > size)
+            return 0;
+
+        if (flag == 0)
+        {
+            flagsPos = destPos++;
+            dest[flagsPos] = 0;
+            flag = 0x80;
+        }
+
+        bestLen = 0;
+        bestDist = 0;
+        if (srcPos + 3 <= size)
+        {
+            candidate = sBlockLZHashHeads[BLOCK_LZ_HASH(&src[srcPos])] - 1;
+            for (chain = 0; candidate >= 0 && chain < BLOCK_LZ_MAX_CHAIN; chain++)
+            {
+                for (len = 0; len < 18 && srcPos + len < size; len++)
+                {
+                    if (src[candidate + len] != src[srcPos + len])
+                        break;
+                }
+                if (len > bestLen)
+                {
+                    bestLen = len;
+                    bestDist = srcPos - candidate;
+                    if (len == 18)
+                        break;
+                }
+                if (sBlockLZHashPrevDist[candidate] == 0)
+                    break;
+                candidate -= sBlockLZHashPrevDist[candidate];
+            }
+        }
+
+        if (bestLen >= 3)
+        {
+            dest[flagsPos] |= flag;
+            dest[destPos++] = ((bestLen - 3) << 4) | ((bestDist - 1) >> 8);
+            dest[destPos++] = bestDist - 1;
+        }
+        else
+        {
+            bestLen = 1;
+            dest[destPos++] = src[srcPos];
+        }
+        flag >>= 1;
+
+        for (; bestLen != 0; bestLen--, srcPos++)
+        {
+            if (srcPos + 3 <= size)
+                InsertBlockLZHash(src, srcPos);
+        }
+    }
+
+    if (destPos >= size)
+        return 0;
+    return destPos;
+}
+
 static void LinkCB_BerryBlenderSendHeldKeys(void)
 {
     GetMultiplayerId();
@@ -1,6 +1,7 @@
 #include "global.h"
 #include "malloc.h"
 #include "berry_powder.h"
+#include "event_object_movement.h"
 #include "item.h"
 #include "load_save.h"
 #include "main.h"
@@ -191,6 +192,8 @@ void LoadObjectEvents(void)
 
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
         gObjectEvents[i] = gSaveBlock1Ptr->objectEvents[i];
+
+    RebuildObjectEventTileIndex();
 }
 
 void CopyPartyAndObjectsToSave(void)
@@ -269,6 +272,7 @@ void SavePlayerBag(void)
     gSaveBlock2Ptr->encryptionKey = gLastEncryptionKey;
     ApplyNewEncryptionKeyToBagItems(encryptionKeyBackup);
     gSaveBlock2Ptr->encryptionKey = encryptionKeyBackup; // updated twice?
+    InvalidateBagItemIndex();
 }
 
 void ApplyNewEncryptionKeyToHword(u16 *hWord, u32 newKey)
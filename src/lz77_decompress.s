@@ -0,0 +1,130 @@
+	.include "asm/macros.inc"
+
+	.syntax unified
+
+	.text
+
+@ void LZ77UnCompWram_Arm(const u32 *src, void *dest)
+@ Decompresses the same LZ77 format as the BIOS's LZ77UnCompWram. It never
+@ writes past the size in the header, and writes a byte at a time, so dest
+@ can't be in VRAM.
+@ Used by LZDecompressWram in decompress.c, which copies this and
+@ LZ77UnCompVram_Arm to IWRAM together, so they must stay next to each other
+@ and only use pc-relative branches.
+	arm_func_start LZ77UnCompWram_Arm
+LZ77UnCompWram_Arm:
+	push {r4, r5}
+	ldr r2, [r0], 4
+	add r2, r1, r2, lsr 8 @ end of dest
+LZ77UnCompWram_Arm_Block:
+	cmp r1, r2
+	bhs LZ77UnCompWram_Arm_Done
+	@ 8 flags in the top byte, with a marker bit below them that's
+	@ shifted out once all 8 have been used
+	ldrb r3, [r0], 1
+	mov r3, r3, lsl 24
+	orr r3, r3, 0x800000
+LZ77UnCompWram_Arm_Next:
+	lsls r3, r3, 1
+	beq LZ77UnCompWram_Arm_Block
+	bcs LZ77UnCompWram_Arm_Match
+	ldrb r12, [r0], 1
+	strb r12, [r1], 1
+	cmp r1, r2
+	blo LZ77UnCompWram_Arm_Next
+	b LZ77UnCompWram_Arm_Done
+LZ77UnCompWram_Arm_Match:
+	ldrb r12, [r0], 1 @ length - 3 in the top 4 bits, top of distance - 1 in the bottom 4
+	ldrb r4, [r0], 1
+	and r5, r12, 0xF
+	orr r4, r4, r5, lsl 8
+	sub r4, r1, r4
+	sub r4, r4, 1 @ start of the match
+	mov r12, r12, lsr 4
+	add r12, r12, 3
+	add r12, r1, r12 @ end of the match
+	cmp r12, r2
+	movhi r12, r2
+LZ77UnCompWram_Arm_Copy:
+	ldrb r5, [r4], 1
+	strb r5, [r1], 1
+	cmp r1, r12
+	blo LZ77UnCompWram_Arm_Copy
+	cmp r1, r2
+	blo LZ77UnCompWram_Arm_Next
+LZ77UnCompWram_Arm_Done:
+	pop {r4, r5}
+	bx lr
+	arm_func_end LZ77UnCompWram_Arm
+
+@ void LZ77UnCompVram_Arm(const u32 *src, void *dest)
+@ Same as LZ77UnCompWram_Arm, but only writes halfwords so that dest can be
+@ in VRAM. Each byte is held in r6 until the byte after it is known. dest must
+@ be halfword aligned. If the size in the header is odd, the last byte is
+@ written together with a zero byte after it, so this writes one byte past the
+@ size, which VRAM can't avoid.
+	arm_func_start LZ77UnCompVram_Arm
+LZ77UnCompVram_Arm:
+	push {r4-r7}
+	ldr r2, [r0], 4
+	add r2, r1, r2, lsr 8 @ end of dest
+	mov r7, 0 @ 1 if r6 holds a byte that hasn't been written yet
+LZ77UnCompVram_Arm_Block:
+	add r12, r1, r7
+	cmp r12, r2
+	bhs LZ77UnCompVram_Arm_Done
+	ldrb r3, [r0], 1
+	mov r3, r3, lsl 24
+	orr r3, r3, 0x800000
+LZ77UnCompVram_Arm_Next:
+	lsls r3, r3, 1
+	beq LZ77UnCompVram_Arm_Block
+	bcs LZ77UnCompVram_Arm_Match
+	ldrb r5, [r0], 1
+	eors r7, r7, 1
+	orreq r6, r6, r5, lsl 8
+	strheq r6, [r1], 2
+	movne r6, r5
+	add r12, r1, r7
+	cmp r12, r2
+	blo LZ77UnCompVram_Arm_Next
+	b LZ77UnCompVram_Arm_Done
+LZ77UnCompVram_Arm_Match:
+	ldrb r12, [r0], 1
+	ldrb r4, [r0], 1
+	and r5, r12, 0xF
+	orr r4, r4, r5, lsl 8
+	add r4, r4, 1
+	add r5, r1, r7
+	sub r4, r5, r4 @ start of the match
+	sub r5, r2, r5 @ bytes left to write
+	mov r12, r12, lsr 4
+	add r12, r12, 3 @ length of the match
+	cmp r12, r5
+	movhi r12, r5
+LZ77UnCompVram_Arm_Copy:
+	@ The byte at r1 hasn't been written yet if the match starts there
+	cmp r4, r1
+	ldrblo r5, [r4]
+	andhs r5, r6, 0xFF
+	add r4, r4, 1
+	eors r7, r7, 1
+	orreq r6, r6, r5, lsl 8
+	strheq r6, [r1], 2
+	movne r6, r5
+	subs r12, r12, 1
+	bne LZ77UnCompVram_Arm_Copy
+	add r12, r1, r7
+	cmp r12, r2
+	blo LZ77UnCompVram_Arm_Next
+LZ77UnCompVram_Arm_Done:
+	cmp r7, 0
+	strhne r6, [r1]
+	pop {r4-r7}
+	bx lr
+	arm_func_end LZ77UnCompVram_Arm
+
+	@ Must fit in sLZ77UnCompRAM_Buffer in decompress.c
+	.if . - LZ77UnCompWram_Arm > 0x140
+	.error "LZ77UnCompWram_Arm and LZ77UnCompVram_Arm are too large for their IWRAM buffer"
+	.endif
@@ -71,6 +71,40 @@ COMMON_DATA s8 gPcmDmaCounter = 0;
 
 static EWRAM_DATA u16 sTrainerId = 0;
 
+#ifdef FRAME_PROFILE
+#define CYCLES_PER_FRAME 280896
+#define FRAME_PROFILE_HISTORY 64
+#define FRAME_PROFILE_PRINT_INTERVAL 600
+#define FRAME_PROFILE_MAX_TASK_FUNCS 16
+
+static const char *const sFrameProfileSectionNames[FRAME_PROFILE_COUNT] =
+{
+    [FRAME_PROFILE_CALLBACK1]       = "callback1",
+    [FRAME_PROFILE_CALLBACK2]       = "callback2",
+    [FRAME_PROFILE_TASKS]           = "RunTasks",
+    [FRAME_PROFILE_ANIMATE_SPRITES] = "AnimateSprites",
+    [FRAME_PROFILE_BUILD_OAM]       = "BuildOamBuffer",
+    [FRAME_PROFILE_VBLANK_CALLBACK] = "vblankCallback",
+    [FRAME_PROFILE_DMA3_REQUESTS]   = "ProcessDma3Requests",
+    [FRAME_PROFILE_FRAME]           = "frame",
+};
+
+// Cycles spent in each section by the frame in progress, and by the last
+// FRAME_PROFILE_HISTORY frames. Sections nest, e.g. RunTasks is usually
+// called from callback2, and time spent in interrupts counts towards
+// whatever they interrupted.
+static EWRAM_DATA u32 sFrameProfileCycles[FRAME_PROFILE_COUNT] = {0};
+static EWRAM_DATA u32 sFrameProfileHistory[FRAME_PROFILE_HISTORY][FRAME_PROFILE_COUNT] = {0};
+static EWRAM_DATA u8 sFrameProfileHistoryPos = 0;
+static EWRAM_DATA u8 sFrameProfileHistoryCount = 0;
+static EWRAM_DATA u16 sFrameProfileFrames = 0;
+static EWRAM_DATA u32 sFrameProfileDroppedFrames = 0;
+static EWRAM_DATA void (*sFrameProfileTaskFuncs[FRAME_PROFILE_MAX_TASK_FUNCS])(u8) = {0};
+static EWRAM_DATA u32 sFrameProfileTaskCycles[FRAME_PROFILE_MAX_TASK_FUNCS] = {0};
+
+static void FrameProfile_EndFrame(u32 startCycles, u32 startVBlank);
+#endif
+
 //EWRAM_DATA void (**gFlashTimerIntrFunc)(void) = NULL;
 
 static void UpdateLinkAndCallCallbacks(void);
@@ -130,6 +164,13 @@ void AgbMain(void)
 #endif
     for (;;)
     {
+#ifdef FRAME_PROFILE
+        u32 profileStart;
+        u32 profileVBlank = gMain.vblankCounter1;
+
+        ResumeCycleCounter();
+        profileStart = GetCycleCounter();
+#endif
         ReadKeys();
 
         if (gSoftResetDisabled == FALSE
@@ -164,6 +205,9 @@ void AgbMain(void)
 
         PlayTimeCounter_Update();
         MapMusicMain();
+#ifdef FRAME_PROFILE
+        FrameProfile_EndFrame(profileStart, profileVBlank);
+#endif
         WaitForVBlank();
     }
 }
@@ -187,11 +231,26 @@ static void InitMainCallbacks(void)
 
 static void CallCallbacks(void)
 {
+#ifdef FRAME_PROFILE
+    u32 profileStart = GetCycleCounter();
+
+    if (gMain.callback1)
+        gMain.callback1();
+
+    FrameProfile_AddCycles(FRAME_PROFILE_CALLBACK1, profileStart);
+    profileStart = GetCycleCounter();
+
+    if (gMain.callback2)
+        gMain.callback2();
+
+    FrameProfile_AddCycles(FRAME_PROFILE_CALLBACK2, profileStart);
+#else
     if (gMain.callback1)
         gMain.callback1();
 
     if (gMain.callback2)
         gMain.callback2();
+#endif
 }
 
 void SetMainCallback2(MainCallback callback)
@@ -339,6 +398,10 @@ void SetSerialCallback(IntrCallback callback)
 
 static void VBlankIntr(void)
 {
+#ifdef FRAME_PROFILE
+    u32 profileStart;
+#endif
+
     if (gWirelessCommType != 0)
         RfuVSync();
     else if (gLinkVSyncDisabled == FALSE)
@@ -349,13 +412,26 @@ static void VBlankIntr(void)
     if (gTrainerHillVBlankCounter && *gTrainerHillVBlankCounter < 0xFFFFFFFF)
         (*gTrainerHillVBlankCounter)++;
 
+#ifdef FRAME_PROFILE
+    profileStart = GetCycleCounter();
     if (gMain.vblankCallback)
         gMain.vblankCallback();
+    FrameProfile_AddCycles(FRAME_PROFILE_VBLANK_CALLBACK, profileStart);
+#else
+    if (gMain.vblankCallback)
+        gMain.vblankCallback();
+#endif
 
     gMain.vblankCounter2++;
 
     CopyBufferedValuesToGpuRegs();
+#ifdef FRAME_PROFILE
+    profileStart = GetCycleCounter();
     ProcessDma3Requests();
+    FrameProfile_AddCycles(FRAME_PROFILE_DMA3_REQUESTS, profileStart);
+#else
+    ProcessDma3Requests();
+#endif
 
     gPcmDmaCounter = gSoundInfo.pcmDmaCounter;
 
@@ -441,3 +517,139 @@ void ClearPokemonCrySongs(void)
 {
     CpuFill16(0, gPokemonCrySongs, MAX_POKEMON_CRIES * sizeof(struct PokemonCrySong));
 }
+
+// Timers 1 and 2 cascaded into a 32-bit count of CPU cycles, for profiling.
+// Timer 1 is also briefly used to seed the RNG on the title screen, and the
+// flash code uses timer 2 while saving. The counter is only restarted by
+// ResumeCycleCounter, which must not be called from an interrupt, since that
+// could take timer 2 from the flash code in the middle of a write. While the
+// timers are in use by something else, GetCycleCounter returns 0 and
+// GetCyclesSince drops the sample.
+void StartCycleCounter(void)
+{
+    REG_TM1CNT_H = 0;
+    REG_TM2CNT_H = 0;
+    REG_TM1CNT_L = 0;
+    REG_TM2CNT_L = 0;
+    REG_TM2CNT_H = TIMER_ENABLE | TIMER_COUNTUP;
+    REG_TM1CNT_H = TIMER_ENABLE | TIMER_1CLK;
+}
+
+static bool32 IsCycleCounterRunning(void)
+{
+    return REG_TM1CNT_H == (TIMER_ENABLE | TIMER_1CLK) && REG_TM2CNT_H == (TIMER_ENABLE | TIMER_COUNTUP);
+}
+
+void ResumeCycleCounter(void)
+{
+    if (!IsCycleCounterRunning())
+        StartCycleCounter();
+}
+
+u32 GetCycleCounter(void)
+{
+    u16 high, low;
+
+    if (!IsCycleCounterRunning())
+        return 0;
+
+    // Read the high half again in case the low half overflowed in between
+    do
+    {
+        high = REG_TM2CNT_L;
+        low = REG_TM1CNT_L;
+    } while (high != REG_TM2CNT_L);
+
+    return (high << 16) | low;
+}
+
+u32 GetCyclesSince(u32 startCycles)
+{
+    u32 cycles = GetCycleCounter();
+
+    if (cycles == 0 || startCycles == 0)
+        return 0;
+    return cycles - startCycles;
+}
+
+#ifdef FRAME_PROFILE
+void FrameProfile_AddCycles(u8 section, u32 startCycles)
+{
+    sFrameProfileCycles[section] += GetCyclesSince(startCycles);
+}
+
+void FrameProfile_AddTaskCycles(void (*func)(u8), u32 startCycles)
+{
+    u32 cycles = GetCyclesSince(startCycles);
+    s32 i;
+
+    for (i = 0; i < FRAME_PROFILE_MAX_TASK_FUNCS; i++)
+    {
+        if (sFrameProfileTaskFuncs[i] == func || sFrameProfileTaskFuncs[i] == NULL)
+        {
+            sFrameProfileTaskFuncs[i] = func;
+            sFrameProfileTaskCycles[i] += cycles;
+            return;
+        }
+    }
+}
+
+static void FrameProfile_Print(void)
+{
+    u32 cycles, min, max, total;
+    s32 i, j;
+
+    DebugPrintf("Frame profile: %u frames, %u dropped", sFrameProfileFrames, sFrameProfileDroppedFrames);
+    for (i = 0; i < FRAME_PROFILE_COUNT; i++)
+    {
+        min = 0xFFFFFFFF;
+        max = 0;
+        total = 0;
+        for (j = 0; j < sFrameProfileHistoryCount; j++)
+        {
+            cycles = sFrameProfileHistory[j][i];
+            if (cycles < min)
+                min = cycles;
+            if (cycles > max)
+                max = cycles;
+            total += cycles;
+        }
+        DebugPrintf("  %s: min %u avg %u max %u (max is %u%% of a frame)",
+            sFrameProfileSectionNames[i], min, total / sFrameProfileHistoryCount, max, max / (CYCLES_PER_FRAME / 100));
+    }
+
+    // Task functions are printed by address, which can be looked up in the map file
+    for (i = 0; i < FRAME_PROFILE_MAX_TASK_FUNCS && sFrameProfileTaskFuncs[i] != NULL; i++)
+    {
+        DebugPrintf("  task %x: avg %u", (u32)sFrameProfileTaskFuncs[i], sFrameProfileTaskCycles[i] / sFrameProfileFrames);
+        sFrameProfileTaskFuncs[i] = NULL;
+        sFrameProfileTaskCycles[i] = 0;
+    }
+}
+
+static void FrameProfile_EndFrame(u32 startCycles, u32 startVBlank)
+{
+    s32 i;
+
+    // The main loop should only ever wait for one VBlank
+    if (gMain.vblankCounter1 != startVBlank)
+        sFrameProfileDroppedFrames += gMain.vblankCounter1 - startVBlank;
+
+    FrameProfile_AddCycles(FRAME_PROFILE_FRAME, startCycles);
+    for (i = 0; i < FRAME_PROFILE_COUNT; i++)
+    {
+        sFrameProfileHistory[sFrameProfileHistoryPos][i] = sFrameProfileCycles[i];
+        sFrameProfileCycles[i] = 0;
+    }
+    sFrameProfileHistoryPos = (sFrameProfileHistoryPos + 1) % FRAME_PROFILE_HISTORY;
+    if (sFrameProfileHistoryCount < FRAME_PROFILE_HISTORY)
+        sFrameProfileHistoryCount++;
+
+    if (++sFrameProfileFrames >= FRAME_PROFILE_PRINT_INTERVAL)
+    {
+        FrameProfile_Print();
+        sFrameProfileFrames = 0;
+        sFrameProfileDroppedFrames = 0;
+    }
+}
+#endif
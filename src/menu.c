@@ -2,6 +2,7 @@
 #include "malloc.h"
 #include "bg.h"
 #include "blit.h"
+#include "decompress.h"
 #include "dma3.h"
 #include "event_data.h"
 #include "graphics.h"
@@ -59,6 +60,7 @@ static void WindowFunc_ClearDialogWindowAndFrameNullPalette(u8, u8, u8, u8, u8,
 static void WindowFunc_DrawStdFrameWithCustomTileAndPalette(u8, u8, u8, u8, u8, u8);
 static void WindowFunc_ClearStdWindowAndFrameToTransparent(u8, u8, u8, u8, u8, u8);
 static void task_free_buf_after_copying_tile_data_to_vram(u8 taskId);
+static void Task_DecompressBgGfxInSteps(u8 taskId);
 
 static EWRAM_DATA u8 sStartMenuWindowId = 0;
 static EWRAM_DATA u8 sMapNamePopupWindowId = 0;
@@ -1809,6 +1811,50 @@ void DecompressAndLoadBgGfxUsingHeap(u8 bgId, const void *src, u32 size, u16 off
     }
 }
 
+// Like DecompressAndLoadBgGfxUsingHeap, but the data is decompressed bytesPerFrame at a time
+// by a task instead of all at once. IsDecompressingBgGfxUsingHeap returns TRUE until it's
+// been decompressed and queued to be copied to VRAM. It only tracks loads started by this
+// function, not by DecompressAndLoadBgGfxUsingHeap.
+void DecompressAndLoadBgGfxUsingHeapInSteps(u8 bgId, const void *src, u32 size, u16 offset, u8 mode, u16 bytesPerFrame)
+{
+    u8 taskId;
+    void *ptr = Alloc(GetDecompressedDataSize(src));
+
+    if (ptr)
+    {
+        if (!size)
+            size = GetDecompressedDataSize(src);
+        taskId = CreateTask(Task_DecompressBgGfxInSteps, 0);
+        gTasks[taskId].data[0] = bgId;
+        gTasks[taskId].data[1] = mode;
+        // data[2] to data[9] hold the decompression state
+        LZDecompressStart((struct LZDecompressState *)&gTasks[taskId].data[2], src, ptr);
+        SetWordTaskArg(taskId, 10, (u32)ptr);
+        gTasks[taskId].data[12] = bytesPerFrame;
+        gTasks[taskId].data[13] = offset;
+        SetWordTaskArg(taskId, 14, size);
+    }
+}
+
+static void Task_DecompressBgGfxInSteps(u8 taskId)
+{
+    s16 *data = gTasks[taskId].data;
+    void *ptr;
+
+    if (LZDecompressContinue((struct LZDecompressState *)&data[2], (u16)data[12]))
+        return;
+
+    ptr = (void *)GetWordTaskArg(taskId, 10);
+    data[0] = copy_decompressed_tile_data_to_vram(data[0], ptr, GetWordTaskArg(taskId, 14), data[13], data[1]);
+    SetWordTaskArg(taskId, 1, (u32)ptr);
+    gTasks[taskId].func = task_free_buf_after_copying_tile_data_to_vram;
+}
+
+bool8 IsDecompressingBgGfxUsingHeap(void)
+{
+    return FuncIsActiveTask(Task_DecompressBgGfxInSteps);
+}
+
 void task_free_buf_after_copying_tile_data_to_vram(u8 taskId)
 {
     if (!CheckForSpaceForDma3Request(gTasks[taskId].data[0]))
@@ -1831,7 +1877,7 @@ void *malloc_and_decompress(const void *src, u32 *size)
 
     ptr = Alloc(*size);
     if (ptr)
-        LZ77UnCompWram(src, ptr);
+        LZDecompressWram(src, ptr);
     return ptr;
 }
 
@@ -1571,6 +1571,8 @@ void CB2_WhiteOut(void)
 
 void CB2_LoadMap(void)
 {
+    // Tilesets can stay in VRAM when warping straight from the overworld.
+    SetReuseMapTilesetsInVram(gMain.vblankCallback == VBlankCB_Field);
     FieldClearVBlankHBlankCallbacks();
     ScriptContext_Init();
     UnlockPlayerFieldControls();
@@ -1582,6 +1584,7 @@ void CB2_LoadMap(void)
 static void CB2_LoadMap2(void)
 {
     DoMapLoadLoop(&gMain.state);
+    SetReuseMapTilesetsInVram(FALSE);
     SetFieldVBlankCallback();
     SetMainCallback1(CB1_Overworld);
     SetMainCallback2(CB2_Overworld);
@@ -1787,7 +1790,7 @@ static void VBlankCB_Field(void)
     ProcessSpriteCopyRequests();
     ScanlineEffect_InitHBlankDmaTransfer();
     FieldUpdateBgTilemapScroll();
-    TransferPlttBuffer();
+    TransferDirtyPlttBuffer();
     TransferTilesetAnimsBuffer();
 }
 
@@ -2080,7 +2083,7 @@ static void ResetScreenForMapLoad(void)
     ScanlineEffect_Stop();
 
     DmaClear16(3, PLTT + 2, PLTT_SIZE - 2);
-    DmaFillLarge16(3, 0, (void *)VRAM, VRAM_SIZE, 0x1000);
+    ClearVramForMapLoad();
     ResetOamRange(0, 128);
     LoadOam();
 }
@@ -2961,6 +2964,7 @@ static void InitLinkPlayerObjectEventPos(struct ObjectEvent *objEvent, s16 x, s1
     objEvent->currentCoords.y = y;
     objEvent->previousCoords.x = x;
     objEvent->previousCoords.y = y;
+    UpdateObjectEventTileIndex(objEvent);
     SetSpritePosToMapCoords(x, y, &objEvent->initialCoords.x, &objEvent->initialCoords.y);
     objEvent->initialCoords.x += 8;
     ObjectEventUpdateElevation(objEvent);
@@ -2985,6 +2989,7 @@ static void UNUSED DestroyLinkPlayerObject(u8 linkPlayerId)
         DestroySprite(&gSprites[objEvent->spriteId]);
     linkPlayerObjEvent->active = 0;
     objEvent->active = 0;
+    UpdateObjectEventTileIndex(objEvent);
 }
 
 // Returns the spriteId corresponding to this player.
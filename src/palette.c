@@ -3,6 +3,7 @@
 #include "util.h"
 #include "decompress.h"
 #include "gpu_regs.h"
+#include "main.h"
 #include "task.h"
 #include "constants/rgb.h"
 
@@ -64,6 +65,9 @@ static EWRAM_DATA struct PaletteStruct sPaletteStructs[NUM_PALETTE_STRUCTS] = {0
 EWRAM_DATA struct PaletteFadeControl gPaletteFade = {0};
 static EWRAM_DATA u32 sFiller = 0;
 static EWRAM_DATA u32 sPlttBufferTransferPending = 0;
+static EWRAM_DATA u32 sPlttBufferDirtyPalettes = 0;
+static EWRAM_DATA u32 sLastDirtyPlttTransferFrame = 0;
+EWRAM_DATA u16 gPlttBufferBytesTransferred = 0;
 EWRAM_DATA u8 ALIGNED(2) gPaletteDecompressionBuffer[PLTT_SIZE] = {0};
 
 static const struct PaletteStructTemplate sDummyPaletteStructTemplate = {
@@ -86,18 +90,44 @@ void LoadCompressedPalette(const u32 *src, u16 offset, u16 size)
     LZDecompressWram(src, gPaletteDecompressionBuffer);
     CpuCopy16(gPaletteDecompressionBuffer, &gPlttBufferUnfaded[offset], size);
     CpuCopy16(gPaletteDecompressionBuffer, &gPlttBufferFaded[offset], size);
+    MarkPaletteRangeDirty(offset, size / sizeof(u16));
 }
 
 void LoadPalette(const void *src, u16 offset, u16 size)
 {
     CpuCopy16(src, &gPlttBufferUnfaded[offset], size);
     CpuCopy16(src, &gPlttBufferFaded[offset], size);
+    MarkPaletteRangeDirty(offset, size / sizeof(u16));
 }
 
 void FillPalette(u16 value, u16 offset, u16 size)
 {
     CpuFill16(value, &gPlttBufferUnfaded[offset], size);
     CpuFill16(value, &gPlttBufferFaded[offset], size);
+    MarkPaletteRangeDirty(offset, size / sizeof(u16));
+}
+
+// Records that palettes in gPlttBufferFaded were changed, for TransferDirtyPlttBuffer.
+// Anything that writes to gPlttBufferFaded while it is in use must call one of these.
+void MarkPalettesDirty(u32 selectedPalettes)
+{
+    sPlttBufferDirtyPalettes |= selectedPalettes;
+}
+
+void MarkPaletteRangeDirty(u16 offset, u16 numColors)
+{
+    u32 first, last;
+
+    if (numColors == 0)
+        return;
+
+    first = offset / 16;
+    last = (offset + numColors - 1) / 16;
+    if (last >= 32)
+        last = 31;
+
+    // (2 << 31) - 1 wraps around to include every palette
+    sPlttBufferDirtyPalettes |= ((2u << last) - 1) & ~((1u << first) - 1);
 }
 
 void TransferPlttBuffer(void)
@@ -107,10 +137,62 @@ void TransferPlttBuffer(void)
         void *src = gPlttBufferFaded;
         void *dest = (void *)PLTT;
         DmaCopy16(3, src, dest, PLTT_SIZE);
+        gPlttBufferBytesTransferred = PLTT_SIZE;
         sPlttBufferTransferPending = FALSE;
         if (gPaletteFade.mode == HARDWARE_FADE && gPaletteFade.active)
             UpdateBlendRegisters();
     }
+    else
+    {
+        gPlttBufferBytesTransferred = 0;
+    }
+}
+
+// Like TransferPlttBuffer, but only uploads the palettes that were marked dirty since the last
+// transfer. This relies on every write to gPlttBufferFaded being marked, so it's only used by
+// the overworld's VBlank callback. If the previous VBlank didn't also do a dirty transfer, the
+// palettes may have been changed by code that doesn't mark them, so everything is uploaded.
+void TransferDirtyPlttBuffer(void)
+{
+    u32 dirtyPalettes;
+    u32 start, end;
+
+    if (gPaletteFade.bufferTransferDisabled)
+    {
+        gPlttBufferBytesTransferred = 0;
+        return;
+    }
+
+    dirtyPalettes = sPlttBufferDirtyPalettes;
+    if (sLastDirtyPlttTransferFrame + 1 != gMain.vblankCounter1)
+        dirtyPalettes = PALETTES_ALL;
+    sLastDirtyPlttTransferFrame = gMain.vblankCounter1;
+    sPlttBufferDirtyPalettes = 0;
+
+    // Upload each run of consecutive dirty palettes with one DMA
+    gPlttBufferBytesTransferred = 0;
+    for (end = 0; dirtyPalettes != 0;)
+    {
+        if (!(dirtyPalettes & 1))
+        {
+            dirtyPalettes >>= 1;
+            end++;
+            continue;
+        }
+
+        start = end;
+        while (dirtyPalettes & 1)
+        {
+            dirtyPalettes >>= 1;
+            end++;
+        }
+        DmaCopy16(3, &gPlttBufferFaded[PLTT_ID(start)], (void *)(PLTT + PLTT_SIZEOF(PLTT_ID(start))), PLTT_SIZEOF(PLTT_ID(end - start)));
+        gPlttBufferBytesTransferred += PLTT_SIZEOF(PLTT_ID(end - start));
+    }
+
+    sPlttBufferTransferPending = FALSE;
+    if (gPaletteFade.mode == HARDWARE_FADE && gPaletteFade.active)
+        UpdateBlendRegisters();
 }
 
 u8 UpdatePaletteFade(void)
@@ -153,6 +235,7 @@ static void ReadPlttIntoBuffers(void)
         gPlttBufferUnfaded[i] = pltt[i];
         gPlttBufferFaded[i] = pltt[i];
     }
+    MarkPalettesDirty(PALETTES_ALL);
 }
 
 bool8 BeginNormalPaletteFade(u32 selectedPalettes, s8 delay, u8 startY, u8 targetY, u16 blendColor)
@@ -279,6 +362,7 @@ static void PaletteStruct_Copy(struct PaletteStruct *palStruct, u32 *unkFlags)
     }
 
     *unkFlags |= 1 << (palStruct->baseDestOffset >> 4);
+    MarkPaletteRangeDirty(palStruct->baseDestOffset, palStruct->template->size);
 }
 
 static void PaletteStruct_Blend(struct PaletteStruct *palStruct, u32 *unkFlags)
@@ -307,6 +391,7 @@ static void PaletteStruct_Blend(struct PaletteStruct *palStruct, u32 *unkFlags)
 
                     for (i = 0; i < palStruct->template->size; i++)
                         gPlttBufferFaded[palStruct->baseDestOffset + i] = palStruct->template->src[srcOffset + i];
+                    MarkPaletteRangeDirty(palStruct->baseDestOffset, palStruct->template->size);
                 }
             }
         }
@@ -495,6 +580,8 @@ void InvertPlttBuffer(u32 selectedPalettes)
 {
     u16 paletteOffset = 0;
 
+    MarkPalettesDirty(selectedPalettes);
+
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -512,6 +599,8 @@ void TintPlttBuffer(u32 selectedPalettes, s8 r, s8 g, s8 b)
 {
     u16 paletteOffset = 0;
 
+    MarkPalettesDirty(selectedPalettes);
+
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -534,6 +623,8 @@ void UnfadePlttBuffer(u32 selectedPalettes)
 {
     u16 paletteOffset = 0;
 
+    MarkPalettesDirty(selectedPalettes);
+
     while (selectedPalettes)
     {
         if (selectedPalettes & 1)
@@ -560,6 +651,8 @@ static void BeginFastPaletteFadeInternal(u8 submode)
     gPaletteFade.active = TRUE;
     gPaletteFade.mode = FAST_FADE;
 
+    MarkPalettesDirty(PALETTES_ALL);
+
     if (submode == FAST_FADE_IN_FROM_BLACK)
         CpuFill16(RGB_BLACK, gPlttBufferFaded, PLTT_SIZE);
 
@@ -592,11 +685,13 @@ static u8 UpdateFastPaletteFade(void)
     {
         paletteOffsetStart = OBJ_PLTT_OFFSET;
         paletteOffsetEnd = PLTT_BUFFER_SIZE;
+        MarkPalettesDirty(PALETTES_OBJECTS);
     }
     else
     {
         paletteOffsetStart = 0;
         paletteOffsetEnd = OBJ_PLTT_OFFSET;
+        MarkPalettesDirty(PALETTES_BG);
     }
 
     switch (gPaletteFade_submode)
@@ -704,6 +799,7 @@ static u8 UpdateFastPaletteFade(void)
 
     if (gPaletteFade.y == 0)
     {
+        MarkPalettesDirty(PALETTES_ALL);
         switch (gPaletteFade_submode)
         {
         case FAST_FADE_IN_FROM_WHITE:
@@ -846,6 +942,7 @@ void BlendPalettesUnfaded(u32 selectedPalettes, u8 coeff, u16 color)
     void *src = gPlttBufferUnfaded;
     void *dest = gPlttBufferFaded;
     DmaCopy32(3, src, dest, PLTT_SIZE);
+    MarkPalettesDirty(PALETTES_ALL);
     BlendPalettes(selectedPalettes, coeff, color);
 }
 
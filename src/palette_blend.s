@@ -0,0 +1,48 @@
+	.include "asm/macros.inc"
+
+	.syntax unified
+
+	.text
+
+@ void BlendColorPairs_Arm(const u32 *src, u32 *dest, u32 numPairs, u32 coeff, u32 blendColor)
+@ Blends numPairs pairs of BGR555 colors towards blendColor by coeff / 16, where
+@ coeff is at most 16. See BlendColorPairs in util.c, which copies this to IWRAM,
+@ so it must only use pc-relative branches and literals.
+	arm_func_start BlendColorPairs_Arm
+BlendColorPairs_Arm:
+	cmp r2, 0
+	bxeq lr
+	push {r4-r11}
+	ldr r11, BlendColorPairs_Arm_MaskA
+	ldr r10, BlendColorPairs_Arm_MaskB
+	ldr r4, [sp, 0x20]
+	orr r4, r4, r4, lsl 16
+	and r5, r4, r11
+	mul r5, r3, r5 @ blended channels of blendColor, mask A
+	and r6, r10, r4, lsr 5
+	mul r6, r3, r6 @ blended channels of blendColor, mask B
+	rsb r3, r3, 16
+BlendColorPairs_Arm_Loop:
+	ldr r4, [r0], 4
+	and r7, r4, r11
+	mla r7, r3, r7, r5
+	and r8, r10, r4, lsr 5
+	mla r8, r3, r8, r6
+	and r7, r11, r7, lsr 4
+	and r8, r10, r8, lsr 4
+	orr r7, r7, r8, lsl 5
+	str r7, [r1], 4
+	subs r2, r2, 1
+	bne BlendColorPairs_Arm_Loop
+	pop {r4-r11}
+	bx lr
+
+	.align 2, 0
+BlendColorPairs_Arm_MaskA: .word 0x03E07C1F
+BlendColorPairs_Arm_MaskB: .word 0x03E0F81F
+	arm_func_end BlendColorPairs_Arm
+
+	@ Must fit in sBlendColorPairsRAM_Buffer in util.c
+	.if . - BlendColorPairs_Arm > 0x80
+	.error "BlendColorPairs_Arm is too large for its IWRAM buffer"
+	.endif
@@ -106,6 +106,19 @@ enum {
 
 #define MAX_MONS_ON_SCREEN 4
 
+// The Pokédex flags are stored as bytes, which are read and written a word at a
+// time by GetPokedexFlagWords. Bit n of a word array is National Dex number n + 1.
+#define READ_DEX_FLAG_WORD(bytes, i) ((bytes)[(i) * 4] | ((bytes)[(i) * 4 + 1] << 8) | ((bytes)[(i) * 4 + 2] << 16) | ((u32)(bytes)[(i) * 4 + 3] << 24))
+#define WRITE_DEX_FLAG_WORD(bytes, i, word)     \
+{                                               \
+    (bytes)[(i) * 4] = (word);                  \
+    (bytes)[(i) * 4 + 1] = (word) >> 8;         \
+    (bytes)[(i) * 4 + 2] = (word) >> 16;        \
+    (bytes)[(i) * 4 + 3] = (word) >> 24;        \
+}
+STATIC_ASSERT(NUM_DEX_FLAG_BYTES % 4 == 0, DexFlagBytesAreWholeWords)
+#define IS_DEX_FLAG_SET(flags, dexNum) (((flags)[((dexNum) - 1) / 32] >> (((dexNum) - 1) % 32)) & 1)
+
 #define LIST_SCROLL_STEP         16
 
 #define POKEBALL_ROTATION_TOP    64
@@ -2181,8 +2194,15 @@ static void CreatePokedexList(u8 dexMode, u8 order)
 #define temp_isHoennDex vars[1]
 #define temp_dexNum     vars[2]
     s16 i;
+    u32 seen[NUM_DEX_FLAG_WORDS];
+    u32 caught[NUM_DEX_FLAG_WORDS];
 
     sPokedexView->pokemonListCount = 0;
+    // The weight and height orders only list caught Pokémon
+    if (order == ORDER_NUMERICAL || order == ORDER_ALPHABETICAL)
+        GetPokedexFlagWords(seen, caught);
+    else
+        GetPokedexFlagWords(NULL, caught);
 
     switch (dexMode)
     {
@@ -2214,8 +2234,8 @@ static void CreatePokedexList(u8 dexMode, u8 order)
             {
                 temp_dexNum = HoennToNationalOrder(i + 1);
                 sPokedexView->pokedexList[i].dexNum = temp_dexNum;
-                sPokedexView->pokedexList[i].seen = GetSetPokedexFlag(temp_dexNum, FLAG_GET_SEEN);
-                sPokedexView->pokedexList[i].owned = GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT);
+                sPokedexView->pokedexList[i].seen = IS_DEX_FLAG_SET(seen, temp_dexNum);
+                sPokedexView->pokedexList[i].owned = IS_DEX_FLAG_SET(caught, temp_dexNum);
                 if (sPokedexView->pokedexList[i].seen)
                     sPokedexView->pokemonListCount = i + 1;
             }
@@ -2226,13 +2246,13 @@ static void CreatePokedexList(u8 dexMode, u8 order)
             for (i = 0, r5 = 0, r10 = 0; i < temp_dexCount; i++)
             {
                 temp_dexNum = i + 1;
-                if (GetSetPokedexFlag(temp_dexNum, FLAG_GET_SEEN))
+                if (IS_DEX_FLAG_SET(seen, temp_dexNum))
                     r10 = 1;
                 if (r10)
                 {
                     sPokedexView->pokedexList[r5].dexNum = temp_dexNum;
-                    sPokedexView->pokedexList[r5].seen = GetSetPokedexFlag(temp_dexNum, FLAG_GET_SEEN);
-                    sPokedexView->pokedexList[r5].owned = GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT);
+                    sPokedexView->pokedexList[r5].seen = IS_DEX_FLAG_SET(seen, temp_dexNum);
+                    sPokedexView->pokedexList[r5].owned = IS_DEX_FLAG_SET(caught, temp_dexNum);
                     if (sPokedexView->pokedexList[r5].seen)
                         sPokedexView->pokemonListCount = r5 + 1;
                     r5++;
@@ -2245,11 +2265,11 @@ static void CreatePokedexList(u8 dexMode, u8 order)
         {
             temp_dexNum = gPokedexOrder_Alphabetical[i];
 
-            if (NationalToHoennOrder(temp_dexNum) <= temp_dexCount && GetSetPokedexFlag(temp_dexNum, FLAG_GET_SEEN))
+            if (NationalToHoennOrder(temp_dexNum) <= temp_dexCount && IS_DEX_FLAG_SET(seen, temp_dexNum))
             {
                 sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
                 sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT);
+                sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = IS_DEX_FLAG_SET(caught, temp_dexNum);
                 sPokedexView->pokemonListCount++;
             }
         }
@@ -2259,7 +2279,7 @@ static void CreatePokedexList(u8 dexMode, u8 order)
         {
             temp_dexNum = gPokedexOrder_Weight[i];
 
-            if (NationalToHoennOrder(temp_dexNum) <= temp_dexCount && GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT))
+            if (NationalToHoennOrder(temp_dexNum) <= temp_dexCount && IS_DEX_FLAG_SET(caught, temp_dexNum))
             {
                 sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
                 sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
@@ -2273,7 +2293,7 @@ static void CreatePokedexList(u8 dexMode, u8 order)
         {
             temp_dexNum = gPokedexOrder_Weight[i];
 
-            if (NationalToHoennOrder(temp_dexNum) <= temp_dexCount && GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT))
+            if (NationalToHoennOrder(temp_dexNum) <= temp_dexCount && IS_DEX_FLAG_SET(caught, temp_dexNum))
             {
                 sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
                 sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
@@ -2287,7 +2307,7 @@ static void CreatePokedexList(u8 dexMode, u8 order)
         {
             temp_dexNum = gPokedexOrder_Height[i];
 
-            if (NationalToHoennOrder(temp_dexNum) <= temp_dexCount && GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT))
+            if (NationalToHoennOrder(temp_dexNum) <= temp_dexCount && IS_DEX_FLAG_SET(caught, temp_dexNum))
             {
                 sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
                 sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
@@ -2301,7 +2321,7 @@ static void CreatePokedexList(u8 dexMode, u8 order)
         {
             temp_dexNum = gPokedexOrder_Height[i];
 
-            if (NationalToHoennOrder(temp_dexNum) <= temp_dexCount && GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT))
+            if (NationalToHoennOrder(temp_dexNum) <= temp_dexCount && IS_DEX_FLAG_SET(caught, temp_dexNum))
             {
                 sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
                 sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
@@ -4318,122 +4338,179 @@ s8 GetSetPokedexFlag(u16 nationalDexNo, u8 caseID)
     return retVal;
 }
 
-u16 GetNationalPokedexCount(u8 caseID)
+// Fills seen and caught with the Pokédex flags, one bit per National Dex number
+// starting from bit 0 of the first word. Either can be NULL if it isn't needed.
+// The save is left as if GetSetPokedexFlag had been called with FLAG_GET_SEEN
+// (if seen isn't NULL) and then FLAG_GET_CAUGHT (if caught isn't NULL) for
+// every National Dex number, so invalid flags are cleared the same way.
+void GetPokedexFlagWords(u32 *seen, u32 *caught)
 {
-    u16 count = 0;
-    u16 i;
+    u32 i;
+    u32 seenWord, seen1Word, seen2Word, ownedWord;
+    u32 dexMask, valid, invalidSeen, invalidOwned;
 
-    for (i = 0; i < NATIONAL_DEX_COUNT; i++)
+    for (i = 0; i < NUM_DEX_FLAG_WORDS; i++)
     {
-        switch (caseID)
+        if ((i + 1) * 32 <= NATIONAL_DEX_COUNT)
+            dexMask = 0xFFFFFFFF;
+        else if (i * 32 < NATIONAL_DEX_COUNT)
+            dexMask = (1 << (NATIONAL_DEX_COUNT % 32)) - 1;
+        else
+            dexMask = 0;
+
+        seenWord = READ_DEX_FLAG_WORD(gSaveBlock2Ptr->pokedex.seen, i);
+        seen1Word = READ_DEX_FLAG_WORD(gSaveBlock1Ptr->seen1, i);
+        seen2Word = READ_DEX_FLAG_WORD(gSaveBlock1Ptr->seen2, i);
+        ownedWord = READ_DEX_FLAG_WORD(gSaveBlock2Ptr->pokedex.owned, i);
+
+        // A flag only counts if it's set in every copy that should have it.
+        // FLAG_GET_SEEN clears an invalid seen flag from the 3 seen copies, and
+        // FLAG_GET_CAUGHT clears an invalid owned flag from all 4.
+        valid = seenWord & seen1Word & seen2Word & dexMask;
+        invalidSeen = 0;
+        invalidOwned = 0;
+        if (seen != NULL)
+            invalidSeen = seenWord & ~valid & dexMask;
+        if (caught != NULL)
+            invalidOwned = ownedWord & ~valid & dexMask;
+        if (invalidSeen | invalidOwned)
         {
-        case FLAG_GET_SEEN:
-            if (GetSetPokedexFlag(i + 1, FLAG_GET_SEEN))
-                count++;
-            break;
-        case FLAG_GET_CAUGHT:
-            if (GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-                count++;
-            break;
+            WRITE_DEX_FLAG_WORD(gSaveBlock2Ptr->pokedex.seen, i, seenWord & ~(invalidSeen | invalidOwned));
+            WRITE_DEX_FLAG_WORD(gSaveBlock1Ptr->seen1, i, seen1Word & ~(invalidSeen | invalidOwned));
+            WRITE_DEX_FLAG_WORD(gSaveBlock1Ptr->seen2, i, seen2Word & ~(invalidSeen | invalidOwned));
+            WRITE_DEX_FLAG_WORD(gSaveBlock2Ptr->pokedex.owned, i, ownedWord & ~invalidOwned);
         }
+
+        if (seen != NULL)
+            seen[i] = valid;
+        if (caught != NULL)
+            caught[i] = ownedWord & valid;
     }
-    return count;
 }
 
-u16 GetHoennPokedexCount(u8 caseID)
+static u32 CountSetBits(u32 word)
 {
+    word = word - ((word >> 1) & 0x55555555);
+    word = (word & 0x33333333) + ((word >> 2) & 0x33333333);
+    word = (word + (word >> 4)) & 0x0F0F0F0F;
+    return (word * 0x01010101) >> 24;
+}
+
+// Counts the flags set for National Dex numbers firstDexNum to lastDexNum, inclusive.
+static u16 CountDexFlagsInRange(const u32 *flags, u16 firstDexNum, u16 lastDexNum)
+{
+    u32 first = firstDexNum - 1;
+    u32 last = lastDexNum - 1;
+    u32 i;
+    u32 word;
     u16 count = 0;
-    u16 i;
 
-    for (i = 0; i < HOENN_DEX_COUNT; i++)
+    for (i = first / 32; i <= last / 32; i++)
     {
-        switch (caseID)
-        {
-        case FLAG_GET_SEEN:
-            if (GetSetPokedexFlag(HoennToNationalOrder(i + 1), FLAG_GET_SEEN))
-                count++;
-            break;
-        case FLAG_GET_CAUGHT:
-            if (GetSetPokedexFlag(HoennToNationalOrder(i + 1), FLAG_GET_CAUGHT))
-                count++;
-            break;
-        }
+        word = flags[i];
+        if (i == first / 32)
+            word &= ~0u << (first % 32);
+        if (i == last / 32)
+            word &= ~0u >> (31 - (last % 32));
+        count += CountSetBits(word);
     }
     return count;
 }
 
-u16 GetKantoPokedexCount(u8 caseID)
+static u16 CountHoennDexFlags(const u32 *flags, u16 count)
 {
-    u16 count = 0;
     u16 i;
+    u16 total = 0;
 
-    for (i = 0; i < KANTO_DEX_COUNT; i++)
+    for (i = 0; i < count; i++)
     {
-        switch (caseID)
-        {
-        case FLAG_GET_SEEN:
-            if (GetSetPokedexFlag(i + 1, FLAG_GET_SEEN))
-                count++;
-            break;
-        case FLAG_GET_CAUGHT:
-            if (GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-                count++;
-            break;
-        }
+        if (IS_DEX_FLAG_SET(flags, HoennToNationalOrder(i + 1)))
+            total++;
     }
-    return count;
+    return total;
+}
+
+// Fills flags with the seen or caught flags, depending on caseID. Returns FALSE
+// if caseID isn't FLAG_GET_SEEN or FLAG_GET_CAUGHT.
+static bool32 GetPokedexFlagWordsForCase(u32 *flags, u8 caseID)
+{
+    switch (caseID)
+    {
+    case FLAG_GET_SEEN:
+        GetPokedexFlagWords(flags, NULL);
+        return TRUE;
+    case FLAG_GET_CAUGHT:
+        GetPokedexFlagWords(NULL, flags);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+u16 GetNationalPokedexCount(u8 caseID)
+{
+    u32 flags[NUM_DEX_FLAG_WORDS];
+
+    if (!GetPokedexFlagWordsForCase(flags, caseID))
+        return 0;
+    return CountDexFlagsInRange(flags, 1, NATIONAL_DEX_COUNT);
+}
+
+u16 GetHoennPokedexCount(u8 caseID)
+{
+    u32 flags[NUM_DEX_FLAG_WORDS];
+
+    if (!GetPokedexFlagWordsForCase(flags, caseID))
+        return 0;
+    return CountHoennDexFlags(flags, HOENN_DEX_COUNT);
+}
+
+u16 GetKantoPokedexCount(u8 caseID)
+{
+    u32 flags[NUM_DEX_FLAG_WORDS];
+
+    if (!GetPokedexFlagWordsForCase(flags, caseID))
+        return 0;
+    return CountDexFlagsInRange(flags, 1, KANTO_DEX_COUNT);
 }
 
 bool16 HasAllHoennMons(void)
 {
-    u16 i;
+    u32 caught[NUM_DEX_FLAG_WORDS];
+
+    GetPokedexFlagWords(NULL, caught);
 
     // -2 excludes Jirachi and Deoxys
-    for (i = 0; i < HOENN_DEX_COUNT - 2; i++)
-    {
-        if (!GetSetPokedexFlag(HoennToNationalOrder(i + 1), FLAG_GET_CAUGHT))
-            return FALSE;
-    }
-    return TRUE;
+    return CountHoennDexFlags(caught, HOENN_DEX_COUNT - 2) == HOENN_DEX_COUNT - 2;
 }
 
 bool8 HasAllKantoMons(void)
 {
-    u16 i;
+    u32 caught[NUM_DEX_FLAG_WORDS];
+
+    GetPokedexFlagWords(NULL, caught);
 
     // -1 excludes Mew
-    for (i = 0; i < KANTO_DEX_COUNT - 1; i++)
-    {
-        if (!GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-            return FALSE;
-    }
-    return TRUE;
+    return CountDexFlagsInRange(caught, 1, KANTO_DEX_COUNT - 1) == KANTO_DEX_COUNT - 1;
 }
 
 bool16 HasAllMons(void)
 {
-    u16 i;
+    u32 caught[NUM_DEX_FLAG_WORDS];
+
+    GetPokedexFlagWords(NULL, caught);
 
     // -1 excludes Mew
-    for (i = 0; i < KANTO_DEX_COUNT - 1; i++)
-    {
-        if (!GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-            return FALSE;
-    }
+    if (CountDexFlagsInRange(caught, 1, KANTO_DEX_COUNT - 1) != KANTO_DEX_COUNT - 1)
+        return FALSE;
 
     // -3 excludes Lugia, Ho-Oh, and Celebi
-    for (i = KANTO_DEX_COUNT; i < JOHTO_DEX_COUNT - 3; i++)
-    {
-        if (!GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-            return FALSE;
-    }
+    if (CountDexFlagsInRange(caught, KANTO_DEX_COUNT + 1, JOHTO_DEX_COUNT - 3) != JOHTO_DEX_COUNT - 3 - KANTO_DEX_COUNT)
+        return FALSE;
 
     // -2 excludes Jirachi and Deoxys
-    for (i = JOHTO_DEX_COUNT; i < NATIONAL_DEX_COUNT - 2; i++)
-    {
-        if (!GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-            return FALSE;
-    }
+    if (CountDexFlagsInRange(caught, JOHTO_DEX_COUNT + 1, NATIONAL_DEX_COUNT - 2) != NATIONAL_DEX_COUNT - 2 - JOHTO_DEX_COUNT)
+        return FALSE;
+
     return TRUE;
 }
 
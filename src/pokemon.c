@@ -97,1259 +97,466 @@ static const struct CombinedMove sCombinedMoves[2] =
     {0xFFFF, 0xFFFF, 0xFFFF}
 };
 
-// NOTE: The order of the elements in the 3 arrays below is irrelevant.
+// NOTE: The order of the species in DEX_SPECIES is irrelevant.
 // To reorder the pokedex, see the values in include/constants/pokedex.h.
-
-#define SPECIES_TO_HOENN(name)      [SPECIES_##name - 1] = HOENN_DEX_##name
-#define SPECIES_TO_NATIONAL(name)   [SPECIES_##name - 1] = NATIONAL_DEX_##name
-#define HOENN_TO_NATIONAL(name)     [HOENN_DEX_##name - 1] = NATIONAL_DEX_##name
+// All 6 arrays below are built from DEX_SPECIES. The last 3 are the inverses of
+// the first 3, so that converting between dex numbers and species never has to
+// search.
+
+#define DEX_SPECIES(X) \
+    X(BULBASAUR)       \
+    X(IVYSAUR)         \
+    X(VENUSAUR)        \
+    X(CHARMANDER)      \
+    X(CHARMELEON)      \
+    X(CHARIZARD)       \
+    X(SQUIRTLE)        \
+    X(WARTORTLE)       \
+    X(BLASTOISE)       \
+    X(CATERPIE)        \
+    X(METAPOD)         \
+    X(BUTTERFREE)      \
+    X(WEEDLE)          \
+    X(KAKUNA)          \
+    X(BEEDRILL)        \
+    X(PIDGEY)          \
+    X(PIDGEOTTO)       \
+    X(PIDGEOT)         \
+    X(RATTATA)         \
+    X(RATICATE)        \
+    X(SPEAROW)         \
+    X(FEAROW)          \
+    X(EKANS)           \
+    X(ARBOK)           \
+    X(PIKACHU)         \
+    X(RAICHU)          \
+    X(SANDSHREW)       \
+    X(SANDSLASH)       \
+    X(NIDORAN_F)       \
+    X(NIDORINA)        \
+    X(NIDOQUEEN)       \
+    X(NIDORAN_M)       \
+    X(NIDORINO)        \
+    X(NIDOKING)        \
+    X(CLEFAIRY)        \
+    X(CLEFABLE)        \
+    X(VULPIX)          \
+    X(NINETALES)       \
+    X(JIGGLYPUFF)      \
+    X(WIGGLYTUFF)      \
+    X(ZUBAT)           \
+    X(GOLBAT)          \
+    X(ODDISH)          \
+    X(GLOOM)           \
+    X(VILEPLUME)       \
+    X(PARAS)           \
+    X(PARASECT)        \
+    X(VENONAT)         \
+    X(VENOMOTH)        \
+    X(DIGLETT)         \
+    X(DUGTRIO)         \
+    X(MEOWTH)          \
+    X(PERSIAN)         \
+    X(PSYDUCK)         \
+    X(GOLDUCK)         \
+    X(MANKEY)          \
+    X(PRIMEAPE)        \
+    X(GROWLITHE)       \
+    X(ARCANINE)        \
+    X(POLIWAG)         \
+    X(POLIWHIRL)       \
+    X(POLIWRATH)       \
+    X(ABRA)            \
+    X(KADABRA)         \
+    X(ALAKAZAM)        \
+    X(MACHOP)          \
+    X(MACHOKE)         \
+    X(MACHAMP)         \
+    X(BELLSPROUT)      \
+    X(WEEPINBELL)      \
+    X(VICTREEBEL)      \
+    X(TENTACOOL)       \
+    X(TENTACRUEL)      \
+    X(GEODUDE)         \
+    X(GRAVELER)        \
+    X(GOLEM)           \
+    X(PONYTA)          \
+    X(RAPIDASH)        \
+    X(SLOWPOKE)        \
+    X(SLOWBRO)         \
+    X(MAGNEMITE)       \
+    X(MAGNETON)        \
+    X(FARFETCHD)       \
+    X(DODUO)           \
+    X(DODRIO)          \
+    X(SEEL)            \
+    X(DEWGONG)         \
+    X(GRIMER)          \
+    X(MUK)             \
+    X(SHELLDER)        \
+    X(CLOYSTER)        \
+    X(GASTLY)          \
+    X(HAUNTER)         \
+    X(GENGAR)          \
+    X(ONIX)            \
+    X(DROWZEE)         \
+    X(HYPNO)           \
+    X(KRABBY)          \
+    X(KINGLER)         \
+    X(VOLTORB)         \
+    X(ELECTRODE)       \
+    X(EXEGGCUTE)       \
+    X(EXEGGUTOR)       \
+    X(CUBONE)          \
+    X(MAROWAK)         \
+    X(HITMONLEE)       \
+    X(HITMONCHAN)      \
+    X(LICKITUNG)       \
+    X(KOFFING)         \
+    X(WEEZING)         \
+    X(RHYHORN)         \
+    X(RHYDON)          \
+    X(CHANSEY)         \
+    X(TANGELA)         \
+    X(KANGASKHAN)      \
+    X(HORSEA)          \
+    X(SEADRA)          \
+    X(GOLDEEN)         \
+    X(SEAKING)         \
+    X(STARYU)          \
+    X(STARMIE)         \
+    X(MR_MIME)         \
+    X(SCYTHER)         \
+    X(JYNX)            \
+    X(ELECTABUZZ)      \
+    X(MAGMAR)          \
+    X(PINSIR)          \
+    X(TAUROS)          \
+    X(MAGIKARP)        \
+    X(GYARADOS)        \
+    X(LAPRAS)          \
+    X(DITTO)           \
+    X(EEVEE)           \
+    X(VAPOREON)        \
+    X(JOLTEON)         \
+    X(FLAREON)         \
+    X(PORYGON)         \
+    X(OMANYTE)         \
+    X(OMASTAR)         \
+    X(KABUTO)          \
+    X(KABUTOPS)        \
+    X(AERODACTYL)      \
+    X(SNORLAX)         \
+    X(ARTICUNO)        \
+    X(ZAPDOS)          \
+    X(MOLTRES)         \
+    X(DRATINI)         \
+    X(DRAGONAIR)       \
+    X(DRAGONITE)       \
+    X(MEWTWO)          \
+    X(MEW)             \
+    X(CHIKORITA)       \
+    X(BAYLEEF)         \
+    X(MEGANIUM)        \
+    X(CYNDAQUIL)       \
+    X(QUILAVA)         \
+    X(TYPHLOSION)      \
+    X(TOTODILE)        \
+    X(CROCONAW)        \
+    X(FERALIGATR)      \
+    X(SENTRET)         \
+    X(FURRET)          \
+    X(HOOTHOOT)        \
+    X(NOCTOWL)         \
+    X(LEDYBA)          \
+    X(LEDIAN)          \
+    X(SPINARAK)        \
+    X(ARIADOS)         \
+    X(CROBAT)          \
+    X(CHINCHOU)        \
+    X(LANTURN)         \
+    X(PICHU)           \
+    X(CLEFFA)          \
+    X(IGGLYBUFF)       \
+    X(TOGEPI)          \
+    X(TOGETIC)         \
+    X(NATU)            \
+    X(XATU)            \
+    X(MAREEP)          \
+    X(FLAAFFY)         \
+    X(AMPHAROS)        \
+    X(BELLOSSOM)       \
+    X(MARILL)          \
+    X(AZUMARILL)       \
+    X(SUDOWOODO)       \
+    X(POLITOED)        \
+    X(HOPPIP)          \
+    X(SKIPLOOM)        \
+    X(JUMPLUFF)        \
+    X(AIPOM)           \
+    X(SUNKERN)         \
+    X(SUNFLORA)        \
+    X(YANMA)           \
+    X(WOOPER)          \
+    X(QUAGSIRE)        \
+    X(ESPEON)          \
+    X(UMBREON)         \
+    X(MURKROW)         \
+    X(SLOWKING)        \
+    X(MISDREAVUS)      \
+    X(UNOWN)           \
+    X(WOBBUFFET)       \
+    X(GIRAFARIG)       \
+    X(PINECO)          \
+    X(FORRETRESS)      \
+    X(DUNSPARCE)       \
+    X(GLIGAR)          \
+    X(STEELIX)         \
+    X(SNUBBULL)        \
+    X(GRANBULL)        \
+    X(QWILFISH)        \
+    X(SCIZOR)          \
+    X(SHUCKLE)         \
+    X(HERACROSS)       \
+    X(SNEASEL)         \
+    X(TEDDIURSA)       \
+    X(URSARING)        \
+    X(SLUGMA)          \
+    X(MAGCARGO)        \
+    X(SWINUB)          \
+    X(PILOSWINE)       \
+    X(CORSOLA)         \
+    X(REMORAID)        \
+    X(OCTILLERY)       \
+    X(DELIBIRD)        \
+    X(MANTINE)         \
+    X(SKARMORY)        \
+    X(HOUNDOUR)        \
+    X(HOUNDOOM)        \
+    X(KINGDRA)         \
+    X(PHANPY)          \
+    X(DONPHAN)         \
+    X(PORYGON2)        \
+    X(STANTLER)        \
+    X(SMEARGLE)        \
+    X(TYROGUE)         \
+    X(HITMONTOP)       \
+    X(SMOOCHUM)        \
+    X(ELEKID)          \
+    X(MAGBY)           \
+    X(MILTANK)         \
+    X(BLISSEY)         \
+    X(RAIKOU)          \
+    X(ENTEI)           \
+    X(SUICUNE)         \
+    X(LARVITAR)        \
+    X(PUPITAR)         \
+    X(TYRANITAR)       \
+    X(LUGIA)           \
+    X(HO_OH)           \
+    X(CELEBI)          \
+    X(OLD_UNOWN_B)     \
+    X(OLD_UNOWN_C)     \
+    X(OLD_UNOWN_D)     \
+    X(OLD_UNOWN_E)     \
+    X(OLD_UNOWN_F)     \
+    X(OLD_UNOWN_G)     \
+    X(OLD_UNOWN_H)     \
+    X(OLD_UNOWN_I)     \
+    X(OLD_UNOWN_J)     \
+    X(OLD_UNOWN_K)     \
+    X(OLD_UNOWN_L)     \
+    X(OLD_UNOWN_M)     \
+    X(OLD_UNOWN_N)     \
+    X(OLD_UNOWN_O)     \
+    X(OLD_UNOWN_P)     \
+    X(OLD_UNOWN_Q)     \
+    X(OLD_UNOWN_R)     \
+    X(OLD_UNOWN_S)     \
+    X(OLD_UNOWN_T)     \
+    X(OLD_UNOWN_U)     \
+    X(OLD_UNOWN_V)     \
+    X(OLD_UNOWN_W)     \
+    X(OLD_UNOWN_X)     \
+    X(OLD_UNOWN_Y)     \
+    X(OLD_UNOWN_Z)     \
+    X(TREECKO)         \
+    X(GROVYLE)         \
+    X(SCEPTILE)        \
+    X(TORCHIC)         \
+    X(COMBUSKEN)       \
+    X(BLAZIKEN)        \
+    X(MUDKIP)          \
+    X(MARSHTOMP)       \
+    X(SWAMPERT)        \
+    X(POOCHYENA)       \
+    X(MIGHTYENA)       \
+    X(ZIGZAGOON)       \
+    X(LINOONE)         \
+    X(WURMPLE)         \
+    X(SILCOON)         \
+    X(BEAUTIFLY)       \
+    X(CASCOON)         \
+    X(DUSTOX)          \
+    X(LOTAD)           \
+    X(LOMBRE)          \
+    X(LUDICOLO)        \
+    X(SEEDOT)          \
+    X(NUZLEAF)         \
+    X(SHIFTRY)         \
+    X(NINCADA)         \
+    X(NINJASK)         \
+    X(SHEDINJA)        \
+    X(TAILLOW)         \
+    X(SWELLOW)         \
+    X(SHROOMISH)       \
+    X(BRELOOM)         \
+    X(SPINDA)          \
+    X(WINGULL)         \
+    X(PELIPPER)        \
+    X(SURSKIT)         \
+    X(MASQUERAIN)      \
+    X(WAILMER)         \
+    X(WAILORD)         \
+    X(SKITTY)          \
+    X(DELCATTY)        \
+    X(KECLEON)         \
+    X(BALTOY)          \
+    X(CLAYDOL)         \
+    X(NOSEPASS)        \
+    X(TORKOAL)         \
+    X(SABLEYE)         \
+    X(BARBOACH)        \
+    X(WHISCASH)        \
+    X(LUVDISC)         \
+    X(CORPHISH)        \
+    X(CRAWDAUNT)       \
+    X(FEEBAS)          \
+    X(MILOTIC)         \
+    X(CARVANHA)        \
+    X(SHARPEDO)        \
+    X(TRAPINCH)        \
+    X(VIBRAVA)         \
+    X(FLYGON)          \
+    X(MAKUHITA)        \
+    X(HARIYAMA)        \
+    X(ELECTRIKE)       \
+    X(MANECTRIC)       \
+    X(NUMEL)           \
+    X(CAMERUPT)        \
+    X(SPHEAL)          \
+    X(SEALEO)          \
+    X(WALREIN)         \
+    X(CACNEA)          \
+    X(CACTURNE)        \
+    X(SNORUNT)         \
+    X(GLALIE)          \
+    X(LUNATONE)        \
+    X(SOLROCK)         \
+    X(AZURILL)         \
+    X(SPOINK)          \
+    X(GRUMPIG)         \
+    X(PLUSLE)          \
+    X(MINUN)           \
+    X(MAWILE)          \
+    X(MEDITITE)        \
+    X(MEDICHAM)        \
+    X(SWABLU)          \
+    X(ALTARIA)         \
+    X(WYNAUT)          \
+    X(DUSKULL)         \
+    X(DUSCLOPS)        \
+    X(ROSELIA)         \
+    X(SLAKOTH)         \
+    X(VIGOROTH)        \
+    X(SLAKING)         \
+    X(GULPIN)          \
+    X(SWALOT)          \
+    X(TROPIUS)         \
+    X(WHISMUR)         \
+    X(LOUDRED)         \
+    X(EXPLOUD)         \
+    X(CLAMPERL)        \
+    X(HUNTAIL)         \
+    X(GOREBYSS)        \
+    X(ABSOL)           \
+    X(SHUPPET)         \
+    X(BANETTE)         \
+    X(SEVIPER)         \
+    X(ZANGOOSE)        \
+    X(RELICANTH)       \
+    X(ARON)            \
+    X(LAIRON)          \
+    X(AGGRON)          \
+    X(CASTFORM)        \
+    X(VOLBEAT)         \
+    X(ILLUMISE)        \
+    X(LILEEP)          \
+    X(CRADILY)         \
+    X(ANORITH)         \
+    X(ARMALDO)         \
+    X(RALTS)           \
+    X(KIRLIA)          \
+    X(GARDEVOIR)       \
+    X(BAGON)           \
+    X(SHELGON)         \
+    X(SALAMENCE)       \
+    X(BELDUM)          \
+    X(METANG)          \
+    X(METAGROSS)       \
+    X(REGIROCK)        \
+    X(REGICE)          \
+    X(REGISTEEL)       \
+    X(KYOGRE)          \
+    X(GROUDON)         \
+    X(RAYQUAZA)        \
+    X(LATIAS)          \
+    X(LATIOS)          \
+    X(JIRACHI)         \
+    X(DEOXYS)          \
+    X(CHIMECHO)
+
+#define SPECIES_TO_HOENN(name)      [SPECIES_##name - 1] = HOENN_DEX_##name,
+#define SPECIES_TO_NATIONAL(name)   [SPECIES_##name - 1] = NATIONAL_DEX_##name,
+#define HOENN_TO_NATIONAL(name)     [HOENN_DEX_##name - 1] = NATIONAL_DEX_##name,
+#define NATIONAL_TO_SPECIES(name)   [NATIONAL_DEX_##name - 1] = SPECIES_##name,
+#define HOENN_TO_SPECIES(name)      [HOENN_DEX_##name - 1] = SPECIES_##name,
+#define NATIONAL_TO_HOENN(name)     [NATIONAL_DEX_##name - 1] = HOENN_DEX_##name,
 
 // Assigns all species to the Hoenn Dex Index (Summary No. for Hoenn Dex)
 static const u16 sSpeciesToHoennPokedexNum[NUM_SPECIES - 1] =
 {
-    SPECIES_TO_HOENN(BULBASAUR),
-    SPECIES_TO_HOENN(IVYSAUR),
-    SPECIES_TO_HOENN(VENUSAUR),
-    SPECIES_TO_HOENN(CHARMANDER),
-    SPECIES_TO_HOENN(CHARMELEON),
-    SPECIES_TO_HOENN(CHARIZARD),
-    SPECIES_TO_HOENN(SQUIRTLE),
-    SPECIES_TO_HOENN(WARTORTLE),
-    SPECIES_TO_HOENN(BLASTOISE),
-    SPECIES_TO_HOENN(CATERPIE),
-    SPECIES_TO_HOENN(METAPOD),
-    SPECIES_TO_HOENN(BUTTERFREE),
-    SPECIES_TO_HOENN(WEEDLE),
-    SPECIES_TO_HOENN(KAKUNA),
-    SPECIES_TO_HOENN(BEEDRILL),
-    SPECIES_TO_HOENN(PIDGEY),
-    SPECIES_TO_HOENN(PIDGEOTTO),
-    SPECIES_TO_HOENN(PIDGEOT),
-    SPECIES_TO_HOENN(RATTATA),
-    SPECIES_TO_HOENN(RATICATE),
-    SPECIES_TO_HOENN(SPEAROW),
-    SPECIES_TO_HOENN(FEAROW),
-    SPECIES_TO_HOENN(EKANS),
-    SPECIES_TO_HOENN(ARBOK),
-    SPECIES_TO_HOENN(PIKACHU),
-    SPECIES_TO_HOENN(RAICHU),
-    SPECIES_TO_HOENN(SANDSHREW),
-    SPECIES_TO_HOENN(SANDSLASH),
-    SPECIES_TO_HOENN(NIDORAN_F),
-    SPECIES_TO_HOENN(NIDORINA),
-    SPECIES_TO_HOENN(NIDOQUEEN),
-    SPECIES_TO_HOENN(NIDORAN_M),
-    SPECIES_TO_HOENN(NIDORINO),
-    SPECIES_TO_HOENN(NIDOKING),
-    SPECIES_TO_HOENN(CLEFAIRY),
-    SPECIES_TO_HOENN(CLEFABLE),
-    SPECIES_TO_HOENN(VULPIX),
-    SPECIES_TO_HOENN(NINETALES),
-    SPECIES_TO_HOENN(JIGGLYPUFF),
-    SPECIES_TO_HOENN(WIGGLYTUFF),
-    SPECIES_TO_HOENN(ZUBAT),
-    SPECIES_TO_HOENN(GOLBAT),
-    SPECIES_TO_HOENN(ODDISH),
-    SPECIES_TO_HOENN(GLOOM),
-    SPECIES_TO_HOENN(VILEPLUME),
-    SPECIES_TO_HOENN(PARAS),
-    SPECIES_TO_HOENN(PARASECT),
-    SPECIES_TO_HOENN(VENONAT),
-    SPECIES_TO_HOENN(VENOMOTH),
-    SPECIES_TO_HOENN(DIGLETT),
-    SPECIES_TO_HOENN(DUGTRIO),
-    SPECIES_TO_HOENN(MEOWTH),
-    SPECIES_TO_HOENN(PERSIAN),
-    SPECIES_TO_HOENN(PSYDUCK),
-    SPECIES_TO_HOENN(GOLDUCK),
-    SPECIES_TO_HOENN(MANKEY),
-    SPECIES_TO_HOENN(PRIMEAPE),
-    SPECIES_TO_HOENN(GROWLITHE),
-    SPECIES_TO_HOENN(ARCANINE),
-    SPECIES_TO_HOENN(POLIWAG),
-    SPECIES_TO_HOENN(POLIWHIRL),
-    SPECIES_TO_HOENN(POLIWRATH),
-    SPECIES_TO_HOENN(ABRA),
-    SPECIES_TO_HOENN(KADABRA),
-    SPECIES_TO_HOENN(ALAKAZAM),
-    SPECIES_TO_HOENN(MACHOP),
-    SPECIES_TO_HOENN(MACHOKE),
-    SPECIES_TO_HOENN(MACHAMP),
-    SPECIES_TO_HOENN(BELLSPROUT),
-    SPECIES_TO_HOENN(WEEPINBELL),
-    SPECIES_TO_HOENN(VICTREEBEL),
-    SPECIES_TO_HOENN(TENTACOOL),
-    SPECIES_TO_HOENN(TENTACRUEL),
-    SPECIES_TO_HOENN(GEODUDE),
-    SPECIES_TO_HOENN(GRAVELER),
-    SPECIES_TO_HOENN(GOLEM),
-    SPECIES_TO_HOENN(PONYTA),
-    SPECIES_TO_HOENN(RAPIDASH),
-    SPECIES_TO_HOENN(SLOWPOKE),
-    SPECIES_TO_HOENN(SLOWBRO),
-    SPECIES_TO_HOENN(MAGNEMITE),
-    SPECIES_TO_HOENN(MAGNETON),
-    SPECIES_TO_HOENN(FARFETCHD),
-    SPECIES_TO_HOENN(DODUO),
-    SPECIES_TO_HOENN(DODRIO),
-    SPECIES_TO_HOENN(SEEL),
-    SPECIES_TO_HOENN(DEWGONG),
-    SPECIES_TO_HOENN(GRIMER),
-    SPECIES_TO_HOENN(MUK),
-    SPECIES_TO_HOENN(SHELLDER),
-    SPECIES_TO_HOENN(CLOYSTER),
-    SPECIES_TO_HOENN(GASTLY),
-    SPECIES_TO_HOENN(HAUNTER),
-    SPECIES_TO_HOENN(GENGAR),
-    SPECIES_TO_HOENN(ONIX),
-    SPECIES_TO_HOENN(DROWZEE),
-    SPECIES_TO_HOENN(HYPNO),
-    SPECIES_TO_HOENN(KRABBY),
-    SPECIES_TO_HOENN(KINGLER),
-    SPECIES_TO_HOENN(VOLTORB),
-    SPECIES_TO_HOENN(ELECTRODE),
-    SPECIES_TO_HOENN(EXEGGCUTE),
-    SPECIES_TO_HOENN(EXEGGUTOR),
-    SPECIES_TO_HOENN(CUBONE),
-    SPECIES_TO_HOENN(MAROWAK),
-    SPECIES_TO_HOENN(HITMONLEE),
-    SPECIES_TO_HOENN(HITMONCHAN),
-    SPECIES_TO_HOENN(LICKITUNG),
-    SPECIES_TO_HOENN(KOFFING),
-    SPECIES_TO_HOENN(WEEZING),
-    SPECIES_TO_HOENN(RHYHORN),
-    SPECIES_TO_HOENN(RHYDON),
-    SPECIES_TO_HOENN(CHANSEY),
-    SPECIES_TO_HOENN(TANGELA),
-    SPECIES_TO_HOENN(KANGASKHAN),
-    SPECIES_TO_HOENN(HORSEA),
-    SPECIES_TO_HOENN(SEADRA),
-    SPECIES_TO_HOENN(GOLDEEN),
-    SPECIES_TO_HOENN(SEAKING),
-    SPECIES_TO_HOENN(STARYU),
-    SPECIES_TO_HOENN(STARMIE),
-    SPECIES_TO_HOENN(MR_MIME),
-    SPECIES_TO_HOENN(SCYTHER),
-    SPECIES_TO_HOENN(JYNX),
-    SPECIES_TO_HOENN(ELECTABUZZ),
-    SPECIES_TO_HOENN(MAGMAR),
-    SPECIES_TO_HOENN(PINSIR),
-    SPECIES_TO_HOENN(TAUROS),
-    SPECIES_TO_HOENN(MAGIKARP),
-    SPECIES_TO_HOENN(GYARADOS),
-    SPECIES_TO_HOENN(LAPRAS),
-    SPECIES_TO_HOENN(DITTO),
-    SPECIES_TO_HOENN(EEVEE),
-    SPECIES_TO_HOENN(VAPOREON),
-    SPECIES_TO_HOENN(JOLTEON),
-    SPECIES_TO_HOENN(FLAREON),
-    SPECIES_TO_HOENN(PORYGON),
-    SPECIES_TO_HOENN(OMANYTE),
-    SPECIES_TO_HOENN(OMASTAR),
-    SPECIES_TO_HOENN(KABUTO),
-    SPECIES_TO_HOENN(KABUTOPS),
-    SPECIES_TO_HOENN(AERODACTYL),
-    SPECIES_TO_HOENN(SNORLAX),
-    SPECIES_TO_HOENN(ARTICUNO),
-    SPECIES_TO_HOENN(ZAPDOS),
-    SPECIES_TO_HOENN(MOLTRES),
-    SPECIES_TO_HOENN(DRATINI),
-    SPECIES_TO_HOENN(DRAGONAIR),
-    SPECIES_TO_HOENN(DRAGONITE),
-    SPECIES_TO_HOENN(MEWTWO),
-    SPECIES_TO_HOENN(MEW),
-    SPECIES_TO_HOENN(CHIKORITA),
-    SPECIES_TO_HOENN(BAYLEEF),
-    SPECIES_TO_HOENN(MEGANIUM),
-    SPECIES_TO_HOENN(CYNDAQUIL),
-    SPECIES_TO_HOENN(QUILAVA),
-    SPECIES_TO_HOENN(TYPHLOSION),
-    SPECIES_TO_HOENN(TOTODILE),
-    SPECIES_TO_HOENN(CROCONAW),
-    SPECIES_TO_HOENN(FERALIGATR),
-    SPECIES_TO_HOENN(SENTRET),
-    SPECIES_TO_HOENN(FURRET),
-    SPECIES_TO_HOENN(HOOTHOOT),
-    SPECIES_TO_HOENN(NOCTOWL),
-    SPECIES_TO_HOENN(LEDYBA),
-    SPECIES_TO_HOENN(LEDIAN),
-    SPECIES_TO_HOENN(SPINARAK),
-    SPECIES_TO_HOENN(ARIADOS),
-    SPECIES_TO_HOENN(CROBAT),
-    SPECIES_TO_HOENN(CHINCHOU),
-    SPECIES_TO_HOENN(LANTURN),
-    SPECIES_TO_HOENN(PICHU),
-    SPECIES_TO_HOENN(CLEFFA),
-    SPECIES_TO_HOENN(IGGLYBUFF),
-    SPECIES_TO_HOENN(TOGEPI),
-    SPECIES_TO_HOENN(TOGETIC),
-    SPECIES_TO_HOENN(NATU),
-    SPECIES_TO_HOENN(XATU),
-    SPECIES_TO_HOENN(MAREEP),
-    SPECIES_TO_HOENN(FLAAFFY),
-    SPECIES_TO_HOENN(AMPHAROS),
-    SPECIES_TO_HOENN(BELLOSSOM),
-    SPECIES_TO_HOENN(MARILL),
-    SPECIES_TO_HOENN(AZUMARILL),
-    SPECIES_TO_HOENN(SUDOWOODO),
-    SPECIES_TO_HOENN(POLITOED),
-    SPECIES_TO_HOENN(HOPPIP),
-    SPECIES_TO_HOENN(SKIPLOOM),
-    SPECIES_TO_HOENN(JUMPLUFF),
-    SPECIES_TO_HOENN(AIPOM),
-    SPECIES_TO_HOENN(SUNKERN),
-    SPECIES_TO_HOENN(SUNFLORA),
-    SPECIES_TO_HOENN(YANMA),
-    SPECIES_TO_HOENN(WOOPER),
-    SPECIES_TO_HOENN(QUAGSIRE),
-    SPECIES_TO_HOENN(ESPEON),
-    SPECIES_TO_HOENN(UMBREON),
-    SPECIES_TO_HOENN(MURKROW),
-    SPECIES_TO_HOENN(SLOWKING),
-    SPECIES_TO_HOENN(MISDREAVUS),
-    SPECIES_TO_HOENN(UNOWN),
-    SPECIES_TO_HOENN(WOBBUFFET),
-    SPECIES_TO_HOENN(GIRAFARIG),
-    SPECIES_TO_HOENN(PINECO),
-    SPECIES_TO_HOENN(FORRETRESS),
-    SPECIES_TO_HOENN(DUNSPARCE),
-    SPECIES_TO_HOENN(GLIGAR),
-    SPECIES_TO_HOENN(STEELIX),
-    SPECIES_TO_HOENN(SNUBBULL),
-    SPECIES_TO_HOENN(GRANBULL),
-    SPECIES_TO_HOENN(QWILFISH),
-    SPECIES_TO_HOENN(SCIZOR),
-    SPECIES_TO_HOENN(SHUCKLE),
-    SPECIES_TO_HOENN(HERACROSS),
-    SPECIES_TO_HOENN(SNEASEL),
-    SPECIES_TO_HOENN(TEDDIURSA),
-    SPECIES_TO_HOENN(URSARING),
-    SPECIES_TO_HOENN(SLUGMA),
-    SPECIES_TO_HOENN(MAGCARGO),
-    SPECIES_TO_HOENN(SWINUB),
-    SPECIES_TO_HOENN(PILOSWINE),
-    SPECIES_TO_HOENN(CORSOLA),
-    SPECIES_TO_HOENN(REMORAID),
-    SPECIES_TO_HOENN(OCTILLERY),
-    SPECIES_TO_HOENN(DELIBIRD),
-    SPECIES_TO_HOENN(MANTINE),
-    SPECIES_TO_HOENN(SKARMORY),
-    SPECIES_TO_HOENN(HOUNDOUR),
-    SPECIES_TO_HOENN(HOUNDOOM),
-    SPECIES_TO_HOENN(KINGDRA),
-    SPECIES_TO_HOENN(PHANPY),
-    SPECIES_TO_HOENN(DONPHAN),
-    SPECIES_TO_HOENN(PORYGON2),
-    SPECIES_TO_HOENN(STANTLER),
-    SPECIES_TO_HOENN(SMEARGLE),
-    SPECIES_TO_HOENN(TYROGUE),
-    SPECIES_TO_HOENN(HITMONTOP),
-    SPECIES_TO_HOENN(SMOOCHUM),
-    SPECIES_TO_HOENN(ELEKID),
-    SPECIES_TO_HOENN(MAGBY),
-    SPECIES_TO_HOENN(MILTANK),
-    SPECIES_TO_HOENN(BLISSEY),
-    SPECIES_TO_HOENN(RAIKOU),
-    SPECIES_TO_HOENN(ENTEI),
-    SPECIES_TO_HOENN(SUICUNE),
-    SPECIES_TO_HOENN(LARVITAR),
-    SPECIES_TO_HOENN(PUPITAR),
-    SPECIES_TO_HOENN(TYRANITAR),
-    SPECIES_TO_HOENN(LUGIA),
-    SPECIES_TO_HOENN(HO_OH),
-    SPECIES_TO_HOENN(CELEBI),
-    SPECIES_TO_HOENN(OLD_UNOWN_B),
-    SPECIES_TO_HOENN(OLD_UNOWN_C),
-    SPECIES_TO_HOENN(OLD_UNOWN_D),
-    SPECIES_TO_HOENN(OLD_UNOWN_E),
-    SPECIES_TO_HOENN(OLD_UNOWN_F),
-    SPECIES_TO_HOENN(OLD_UNOWN_G),
-    SPECIES_TO_HOENN(OLD_UNOWN_H),
-    SPECIES_TO_HOENN(OLD_UNOWN_I),
-    SPECIES_TO_HOENN(OLD_UNOWN_J),
-    SPECIES_TO_HOENN(OLD_UNOWN_K),
-    SPECIES_TO_HOENN(OLD_UNOWN_L),
-    SPECIES_TO_HOENN(OLD_UNOWN_M),
-    SPECIES_TO_HOENN(OLD_UNOWN_N),
-    SPECIES_TO_HOENN(OLD_UNOWN_O),
-    SPECIES_TO_HOENN(OLD_UNOWN_P),
-    SPECIES_TO_HOENN(OLD_UNOWN_Q),
-    SPECIES_TO_HOENN(OLD_UNOWN_R),
-    SPECIES_TO_HOENN(OLD_UNOWN_S),
-    SPECIES_TO_HOENN(OLD_UNOWN_T),
-    SPECIES_TO_HOENN(OLD_UNOWN_U),
-    SPECIES_TO_HOENN(OLD_UNOWN_V),
-    SPECIES_TO_HOENN(OLD_UNOWN_W),
-    SPECIES_TO_HOENN(OLD_UNOWN_X),
-    SPECIES_TO_HOENN(OLD_UNOWN_Y),
-    SPECIES_TO_HOENN(OLD_UNOWN_Z),
-    SPECIES_TO_HOENN(TREECKO),
-    SPECIES_TO_HOENN(GROVYLE),
-    SPECIES_TO_HOENN(SCEPTILE),
-    SPECIES_TO_HOENN(TORCHIC),
-    SPECIES_TO_HOENN(COMBUSKEN),
-    SPECIES_TO_HOENN(BLAZIKEN),
-    SPECIES_TO_HOENN(MUDKIP),
-    SPECIES_TO_HOENN(MARSHTOMP),
-    SPECIES_TO_HOENN(SWAMPERT),
-    SPECIES_TO_HOENN(POOCHYENA),
-    SPECIES_TO_HOENN(MIGHTYENA),
-    SPECIES_TO_HOENN(ZIGZAGOON),
-    SPECIES_TO_HOENN(LINOONE),
-    SPECIES_TO_HOENN(WURMPLE),
-    SPECIES_TO_HOENN(SILCOON),
-    SPECIES_TO_HOENN(BEAUTIFLY),
-    SPECIES_TO_HOENN(CASCOON),
-    SPECIES_TO_HOENN(DUSTOX),
-    SPECIES_TO_HOENN(LOTAD),
-    SPECIES_TO_HOENN(LOMBRE),
-    SPECIES_TO_HOENN(LUDICOLO),
-    SPECIES_TO_HOENN(SEEDOT),
-    SPECIES_TO_HOENN(NUZLEAF),
-    SPECIES_TO_HOENN(SHIFTRY),
-    SPECIES_TO_HOENN(NINCADA),
-    SPECIES_TO_HOENN(NINJASK),
-    SPECIES_TO_HOENN(SHEDINJA),
-    SPECIES_TO_HOENN(TAILLOW),
-    SPECIES_TO_HOENN(SWELLOW),
-    SPECIES_TO_HOENN(SHROOMISH),
-    SPECIES_TO_HOENN(BRELOOM),
-    SPECIES_TO_HOENN(SPINDA),
-    SPECIES_TO_HOENN(WINGULL),
-    SPECIES_TO_HOENN(PELIPPER),
-    SPECIES_TO_HOENN(SURSKIT),
-    SPECIES_TO_HOENN(MASQUERAIN),
-    SPECIES_TO_HOENN(WAILMER),
-    SPECIES_TO_HOENN(WAILORD),
-    SPECIES_TO_HOENN(SKITTY),
-    SPECIES_TO_HOENN(DELCATTY),
-    SPECIES_TO_HOENN(KECLEON),
-    SPECIES_TO_HOENN(BALTOY),
-    SPECIES_TO_HOENN(CLAYDOL),
-    SPECIES_TO_HOENN(NOSEPASS),
-    SPECIES_TO_HOENN(TORKOAL),
-    SPECIES_TO_HOENN(SABLEYE),
-    SPECIES_TO_HOENN(BARBOACH),
-    SPECIES_TO_HOENN(WHISCASH),
-    SPECIES_TO_HOENN(LUVDISC),
-    SPECIES_TO_HOENN(CORPHISH),
-    SPECIES_TO_HOENN(CRAWDAUNT),
-    SPECIES_TO_HOENN(FEEBAS),
-    SPECIES_TO_HOENN(MILOTIC),
-    SPECIES_TO_HOENN(CARVANHA),
-    SPECIES_TO_HOENN(SHARPEDO),
-    SPECIES_TO_HOENN(TRAPINCH),
-    SPECIES_TO_HOENN(VIBRAVA),
-    SPECIES_TO_HOENN(FLYGON),
-    SPECIES_TO_HOENN(MAKUHITA),
-    SPECIES_TO_HOENN(HARIYAMA),
-    SPECIES_TO_HOENN(ELECTRIKE),
-    SPECIES_TO_HOENN(MANECTRIC),
-    SPECIES_TO_HOENN(NUMEL),
-    SPECIES_TO_HOENN(CAMERUPT),
-    SPECIES_TO_HOENN(SPHEAL),
-    SPECIES_TO_HOENN(SEALEO),
-    SPECIES_TO_HOENN(WALREIN),
-    SPECIES_TO_HOENN(CACNEA),
-    SPECIES_TO_HOENN(CACTURNE),
-    SPECIES_TO_HOENN(SNORUNT),
-    SPECIES_TO_HOENN(GLALIE),
-    SPECIES_TO_HOENN(LUNATONE),
-    SPECIES_TO_HOENN(SOLROCK),
-    SPECIES_TO_HOENN(AZURILL),
-    SPECIES_TO_HOENN(SPOINK),
-    SPECIES_TO_HOENN(GRUMPIG),
-    SPECIES_TO_HOENN(PLUSLE),
-    SPECIES_TO_HOENN(MINUN),
-    SPECIES_TO_HOENN(MAWILE),
-    SPECIES_TO_HOENN(MEDITITE),
-    SPECIES_TO_HOENN(MEDICHAM),
-    SPECIES_TO_HOENN(SWABLU),
-    SPECIES_TO_HOENN(ALTARIA),
-    SPECIES_TO_HOENN(WYNAUT),
-    SPECIES_TO_HOENN(DUSKULL),
-    SPECIES_TO_HOENN(DUSCLOPS),
-    SPECIES_TO_HOENN(ROSELIA),
-    SPECIES_TO_HOENN(SLAKOTH),
-    SPECIES_TO_HOENN(VIGOROTH),
-    SPECIES_TO_HOENN(SLAKING),
-    SPECIES_TO_HOENN(GULPIN),
-    SPECIES_TO_HOENN(SWALOT),
-    SPECIES_TO_HOENN(TROPIUS),
-    SPECIES_TO_HOENN(WHISMUR),
-    SPECIES_TO_HOENN(LOUDRED),
-    SPECIES_TO_HOENN(EXPLOUD),
-    SPECIES_TO_HOENN(CLAMPERL),
-    SPECIES_TO_HOENN(HUNTAIL),
-    SPECIES_TO_HOENN(GOREBYSS),
-    SPECIES_TO_HOENN(ABSOL),
-    SPECIES_TO_HOENN(SHUPPET),
-    SPECIES_TO_HOENN(BANETTE),
-    SPECIES_TO_HOENN(SEVIPER),
-    SPECIES_TO_HOENN(ZANGOOSE),
-    SPECIES_TO_HOENN(RELICANTH),
-    SPECIES_TO_HOENN(ARON),
-    SPECIES_TO_HOENN(LAIRON),
-    SPECIES_TO_HOENN(AGGRON),
-    SPECIES_TO_HOENN(CASTFORM),
-    SPECIES_TO_HOENN(VOLBEAT),
-    SPECIES_TO_HOENN(ILLUMISE),
-    SPECIES_TO_HOENN(LILEEP),
-    SPECIES_TO_HOENN(CRADILY),
-    SPECIES_TO_HOENN(ANORITH),
-    SPECIES_TO_HOENN(ARMALDO),
-    SPECIES_TO_HOENN(RALTS),
-    SPECIES_TO_HOENN(KIRLIA),
-    SPECIES_TO_HOENN(GARDEVOIR),
-    SPECIES_TO_HOENN(BAGON),
-    SPECIES_TO_HOENN(SHELGON),
-    SPECIES_TO_HOENN(SALAMENCE),
-    SPECIES_TO_HOENN(BELDUM),
-    SPECIES_TO_HOENN(METANG),
-    SPECIES_TO_HOENN(METAGROSS),
-    SPECIES_TO_HOENN(REGIROCK),
-    SPECIES_TO_HOENN(REGICE),
-    SPECIES_TO_HOENN(REGISTEEL),
-    SPECIES_TO_HOENN(KYOGRE),
-    SPECIES_TO_HOENN(GROUDON),
-    SPECIES_TO_HOENN(RAYQUAZA),
-    SPECIES_TO_HOENN(LATIAS),
-    SPECIES_TO_HOENN(LATIOS),
-    SPECIES_TO_HOENN(JIRACHI),
-    SPECIES_TO_HOENN(DEOXYS),
-    SPECIES_TO_HOENN(CHIMECHO),
+    DEX_SPECIES(SPECIES_TO_HOENN)
 };
 
 // Assigns all species to the National Dex Index (Summary No. for National Dex)
 static const u16 sSpeciesToNationalPokedexNum[NUM_SPECIES - 1] =
 {
-    SPECIES_TO_NATIONAL(BULBASAUR),
-    SPECIES_TO_NATIONAL(IVYSAUR),
-    SPECIES_TO_NATIONAL(VENUSAUR),
-    SPECIES_TO_NATIONAL(CHARMANDER),
-    SPECIES_TO_NATIONAL(CHARMELEON),
-    SPECIES_TO_NATIONAL(CHARIZARD),
-    SPECIES_TO_NATIONAL(SQUIRTLE),
-    SPECIES_TO_NATIONAL(WARTORTLE),
-    SPECIES_TO_NATIONAL(BLASTOISE),
-    SPECIES_TO_NATIONAL(CATERPIE),
-    SPECIES_TO_NATIONAL(METAPOD),
-    SPECIES_TO_NATIONAL(BUTTERFREE),
-    SPECIES_TO_NATIONAL(WEEDLE),
-    SPECIES_TO_NATIONAL(KAKUNA),
-    SPECIES_TO_NATIONAL(BEEDRILL),
-    SPECIES_TO_NATIONAL(PIDGEY),
-    SPECIES_TO_NATIONAL(PIDGEOTTO),
-    SPECIES_TO_NATIONAL(PIDGEOT),
-    SPECIES_TO_NATIONAL(RATTATA),
-    SPECIES_TO_NATIONAL(RATICATE),
-    SPECIES_TO_NATIONAL(SPEAROW),
-    SPECIES_TO_NATIONAL(FEAROW),
-    SPECIES_TO_NATIONAL(EKANS),
-    SPECIES_TO_NATIONAL(ARBOK),
-    SPECIES_TO_NATIONAL(PIKACHU),
-    SPECIES_TO_NATIONAL(RAICHU),
-    SPECIES_TO_NATIONAL(SANDSHREW),
-    SPECIES_TO_NATIONAL(SANDSLASH),
-    SPECIES_TO_NATIONAL(NIDORAN_F),
-    SPECIES_TO_NATIONAL(NIDORINA),
-    SPECIES_TO_NATIONAL(NIDOQUEEN),
-    SPECIES_TO_NATIONAL(NIDORAN_M),
-    SPECIES_TO_NATIONAL(NIDORINO),
-    SPECIES_TO_NATIONAL(NIDOKING),
-    SPECIES_TO_NATIONAL(CLEFAIRY),
-    SPECIES_TO_NATIONAL(CLEFABLE),
-    SPECIES_TO_NATIONAL(VULPIX),
-    SPECIES_TO_NATIONAL(NINETALES),
-    SPECIES_TO_NATIONAL(JIGGLYPUFF),
-    SPECIES_TO_NATIONAL(WIGGLYTUFF),
-    SPECIES_TO_NATIONAL(ZUBAT),
-    SPECIES_TO_NATIONAL(GOLBAT),
-    SPECIES_TO_NATIONAL(ODDISH),
-    SPECIES_TO_NATIONAL(GLOOM),
-    SPECIES_TO_NATIONAL(VILEPLUME),
-    SPECIES_TO_NATIONAL(PARAS),
-    SPECIES_TO_NATIONAL(PARASECT),
-    SPECIES_TO_NATIONAL(VENONAT),
-    SPECIES_TO_NATIONAL(VENOMOTH),
-    SPECIES_TO_NATIONAL(DIGLETT),
-    SPECIES_TO_NATIONAL(DUGTRIO),
-    SPECIES_TO_NATIONAL(MEOWTH),
-    SPECIES_TO_NATIONAL(PERSIAN),
-    SPECIES_TO_NATIONAL(PSYDUCK),
-    SPECIES_TO_NATIONAL(GOLDUCK),
-    SPECIES_TO_NATIONAL(MANKEY),
-    SPECIES_TO_NATIONAL(PRIMEAPE),
-    SPECIES_TO_NATIONAL(GROWLITHE),
-    SPECIES_TO_NATIONAL(ARCANINE),
-    SPECIES_TO_NATIONAL(POLIWAG),
-    SPECIES_TO_NATIONAL(POLIWHIRL),
-    SPECIES_TO_NATIONAL(POLIWRATH),
-    SPECIES_TO_NATIONAL(ABRA),
-    SPECIES_TO_NATIONAL(KADABRA),
-    SPECIES_TO_NATIONAL(ALAKAZAM),
-    SPECIES_TO_NATIONAL(MACHOP),
-    SPECIES_TO_NATIONAL(MACHOKE),
-    SPECIES_TO_NATIONAL(MACHAMP),
-    SPECIES_TO_NATIONAL(BELLSPROUT),
-    SPECIES_TO_NATIONAL(WEEPINBELL),
-    SPECIES_TO_NATIONAL(VICTREEBEL),
-    SPECIES_TO_NATIONAL(TENTACOOL),
-    SPECIES_TO_NATIONAL(TENTACRUEL),
-    SPECIES_TO_NATIONAL(GEODUDE),
-    SPECIES_TO_NATIONAL(GRAVELER),
-    SPECIES_TO_NATIONAL(GOLEM),
-    SPECIES_TO_NATIONAL(PONYTA),
-    SPECIES_TO_NATIONAL(RAPIDASH),
-    SPECIES_TO_NATIONAL(SLOWPOKE),
-    SPECIES_TO_NATIONAL(SLOWBRO),
-    SPECIES_TO_NATIONAL(MAGNEMITE),
-    SPECIES_TO_NATIONAL(MAGNETON),
-    SPECIES_TO_NATIONAL(FARFETCHD),
-    SPECIES_TO_NATIONAL(DODUO),
-    SPECIES_TO_NATIONAL(DODRIO),
-    SPECIES_TO_NATIONAL(SEEL),
-    SPECIES_TO_NATIONAL(DEWGONG),
-    SPECIES_TO_NATIONAL(GRIMER),
-    SPECIES_TO_NATIONAL(MUK),
-    SPECIES_TO_NATIONAL(SHELLDER),
-    SPECIES_TO_NATIONAL(CLOYSTER),
-    SPECIES_TO_NATIONAL(GASTLY),
-    SPECIES_TO_NATIONAL(HAUNTER),
-    SPECIES_TO_NATIONAL(GENGAR),
-    SPECIES_TO_NATIONAL(ONIX),
-    SPECIES_TO_NATIONAL(DROWZEE),
-    SPECIES_TO_NATIONAL(HYPNO),
-    SPECIES_TO_NATIONAL(KRABBY),
-    SPECIES_TO_NATIONAL(KINGLER),
-    SPECIES_TO_NATIONAL(VOLTORB),
-    SPECIES_TO_NATIONAL(ELECTRODE),
-    SPECIES_TO_NATIONAL(EXEGGCUTE),
-    SPECIES_TO_NATIONAL(EXEGGUTOR),
-    SPECIES_TO_NATIONAL(CUBONE),
-    SPECIES_TO_NATIONAL(MAROWAK),
-    SPECIES_TO_NATIONAL(HITMONLEE),
-    SPECIES_TO_NATIONAL(HITMONCHAN),
-    SPECIES_TO_NATIONAL(LICKITUNG),
-    SPECIES_TO_NATIONAL(KOFFING),
-    SPECIES_TO_NATIONAL(WEEZING),
-    SPECIES_TO_NATIONAL(RHYHORN),
-    SPECIES_TO_NATIONAL(RHYDON),
-    SPECIES_TO_NATIONAL(CHANSEY),
-    SPECIES_TO_NATIONAL(TANGELA),
-    SPECIES_TO_NATIONAL(KANGASKHAN),
-    SPECIES_TO_NATIONAL(HORSEA),
-    SPECIES_TO_NATIONAL(SEADRA),
-    SPECIES_TO_NATIONAL(GOLDEEN),
-    SPECIES_TO_NATIONAL(SEAKING),
-    SPECIES_TO_NATIONAL(STARYU),
-    SPECIES_TO_NATIONAL(STARMIE),
-    SPECIES_TO_NATIONAL(MR_MIME),
-    SPECIES_TO_NATIONAL(SCYTHER),
-    SPECIES_TO_NATIONAL(JYNX),
-    SPECIES_TO_NATIONAL(ELECTABUZZ),
-    SPECIES_TO_NATIONAL(MAGMAR),
-    SPECIES_TO_NATIONAL(PINSIR),
-    SPECIES_TO_NATIONAL(TAUROS),
-    SPECIES_TO_NATIONAL(MAGIKARP),
-    SPECIES_TO_NATIONAL(GYARADOS),
-    SPECIES_TO_NATIONAL(LAPRAS),
-    SPECIES_TO_NATIONAL(DITTO),
-    SPECIES_TO_NATIONAL(EEVEE),
-    SPECIES_TO_NATIONAL(VAPOREON),
-    SPECIES_TO_NATIONAL(JOLTEON),
-    SPECIES_TO_NATIONAL(FLAREON),
-    SPECIES_TO_NATIONAL(PORYGON),
-    SPECIES_TO_NATIONAL(OMANYTE),
-    SPECIES_TO_NATIONAL(OMASTAR),
-    SPECIES_TO_NATIONAL(KABUTO),
-    SPECIES_TO_NATIONAL(KABUTOPS),
-    SPECIES_TO_NATIONAL(AERODACTYL),
-    SPECIES_TO_NATIONAL(SNORLAX),
-    SPECIES_TO_NATIONAL(ARTICUNO),
-    SPECIES_TO_NATIONAL(ZAPDOS),
-    SPECIES_TO_NATIONAL(MOLTRES),
-    SPECIES_TO_NATIONAL(DRATINI),
-    SPECIES_TO_NATIONAL(DRAGONAIR),
-    SPECIES_TO_NATIONAL(DRAGONITE),
-    SPECIES_TO_NATIONAL(MEWTWO),
-    SPECIES_TO_NATIONAL(MEW),
-    SPECIES_TO_NATIONAL(CHIKORITA),
-    SPECIES_TO_NATIONAL(BAYLEEF),
-    SPECIES_TO_NATIONAL(MEGANIUM),
-    SPECIES_TO_NATIONAL(CYNDAQUIL),
-    SPECIES_TO_NATIONAL(QUILAVA),
-    SPECIES_TO_NATIONAL(TYPHLOSION),
-    SPECIES_TO_NATIONAL(TOTODILE),
-    SPECIES_TO_NATIONAL(CROCONAW),
-    SPECIES_TO_NATIONAL(FERALIGATR),
-    SPECIES_TO_NATIONAL(SENTRET),
-    SPECIES_TO_NATIONAL(FURRET),
-    SPECIES_TO_NATIONAL(HOOTHOOT),
-    SPECIES_TO_NATIONAL(NOCTOWL),
-    SPECIES_TO_NATIONAL(LEDYBA),
-    SPECIES_TO_NATIONAL(LEDIAN),
-    SPECIES_TO_NATIONAL(SPINARAK),
-    SPECIES_TO_NATIONAL(ARIADOS),
-    SPECIES_TO_NATIONAL(CROBAT),
-    SPECIES_TO_NATIONAL(CHINCHOU),
-    SPECIES_TO_NATIONAL(LANTURN),
-    SPECIES_TO_NATIONAL(PICHU),
-    SPECIES_TO_NATIONAL(CLEFFA),
-    SPECIES_TO_NATIONAL(IGGLYBUFF),
-    SPECIES_TO_NATIONAL(TOGEPI),
-    SPECIES_TO_NATIONAL(TOGETIC),
-    SPECIES_TO_NATIONAL(NATU),
-    SPECIES_TO_NATIONAL(XATU),
-    SPECIES_TO_NATIONAL(MAREEP),
-    SPECIES_TO_NATIONAL(FLAAFFY),
-    SPECIES_TO_NATIONAL(AMPHAROS),
-    SPECIES_TO_NATIONAL(BELLOSSOM),
-    SPECIES_TO_NATIONAL(MARILL),
-    SPECIES_TO_NATIONAL(AZUMARILL),
-    SPECIES_TO_NATIONAL(SUDOWOODO),
-    SPECIES_TO_NATIONAL(POLITOED),
-    SPECIES_TO_NATIONAL(HOPPIP),
-    SPECIES_TO_NATIONAL(SKIPLOOM),
-    SPECIES_TO_NATIONAL(JUMPLUFF),
-    SPECIES_TO_NATIONAL(AIPOM),
-    SPECIES_TO_NATIONAL(SUNKERN),
-    SPECIES_TO_NATIONAL(SUNFLORA),
-    SPECIES_TO_NATIONAL(YANMA),
-    SPECIES_TO_NATIONAL(WOOPER),
-    SPECIES_TO_NATIONAL(QUAGSIRE),
-    SPECIES_TO_NATIONAL(ESPEON),
-    SPECIES_TO_NATIONAL(UMBREON),
-    SPECIES_TO_NATIONAL(MURKROW),
-    SPECIES_TO_NATIONAL(SLOWKING),
-    SPECIES_TO_NATIONAL(MISDREAVUS),
-    SPECIES_TO_NATIONAL(UNOWN),
-    SPECIES_TO_NATIONAL(WOBBUFFET),
-    SPECIES_TO_NATIONAL(GIRAFARIG),
-    SPECIES_TO_NATIONAL(PINECO),
-    SPECIES_TO_NATIONAL(FORRETRESS),
-    SPECIES_TO_NATIONAL(DUNSPARCE),
-    SPECIES_TO_NATIONAL(GLIGAR),
-    SPECIES_TO_NATIONAL(STEELIX),
-    SPECIES_TO_NATIONAL(SNUBBULL),
-    SPECIES_TO_NATIONAL(GRANBULL),
-    SPECIES_TO_NATIONAL(QWILFISH),
-    SPECIES_TO_NATIONAL(SCIZOR),
-    SPECIES_TO_NATIONAL(SHUCKLE),
-    SPECIES_TO_NATIONAL(HERACROSS),
-    SPECIES_TO_NATIONAL(SNEASEL),
-    SPECIES_TO_NATIONAL(TEDDIURSA),
-    SPECIES_TO_NATIONAL(URSARING),
-    SPECIES_TO_NATIONAL(SLUGMA),
-    SPECIES_TO_NATIONAL(MAGCARGO),
-    SPECIES_TO_NATIONAL(SWINUB),
-    SPECIES_TO_NATIONAL(PILOSWINE),
-    SPECIES_TO_NATIONAL(CORSOLA),
-    SPECIES_TO_NATIONAL(REMORAID),
-    SPECIES_TO_NATIONAL(OCTILLERY),
-    SPECIES_TO_NATIONAL(DELIBIRD),
-    SPECIES_TO_NATIONAL(MANTINE),
-    SPECIES_TO_NATIONAL(SKARMORY),
-    SPECIES_TO_NATIONAL(HOUNDOUR),
-    SPECIES_TO_NATIONAL(HOUNDOOM),
-    SPECIES_TO_NATIONAL(KINGDRA),
-    SPECIES_TO_NATIONAL(PHANPY),
-    SPECIES_TO_NATIONAL(DONPHAN),
-    SPECIES_TO_NATIONAL(PORYGON2),
-    SPECIES_TO_NATIONAL(STANTLER),
-    SPECIES_TO_NATIONAL(SMEARGLE),
-    SPECIES_TO_NATIONAL(TYROGUE),
-    SPECIES_TO_NATIONAL(HITMONTOP),
-    SPECIES_TO_NATIONAL(SMOOCHUM),
-    SPECIES_TO_NATIONAL(ELEKID),
-    SPECIES_TO_NATIONAL(MAGBY),
-    SPECIES_TO_NATIONAL(MILTANK),
-    SPECIES_TO_NATIONAL(BLISSEY),
-    SPECIES_TO_NATIONAL(RAIKOU),
-    SPECIES_TO_NATIONAL(ENTEI),
-    SPECIES_TO_NATIONAL(SUICUNE),
-    SPECIES_TO_NATIONAL(LARVITAR),
-    SPECIES_TO_NATIONAL(PUPITAR),
-    SPECIES_TO_NATIONAL(TYRANITAR),
-    SPECIES_TO_NATIONAL(LUGIA),
-    SPECIES_TO_NATIONAL(HO_OH),
-    SPECIES_TO_NATIONAL(CELEBI),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_B),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_C),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_D),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_E),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_F),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_G),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_H),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_I),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_J),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_K),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_L),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_M),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_N),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_O),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_P),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_Q),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_R),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_S),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_T),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_U),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_V),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_W),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_X),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_Y),
-    SPECIES_TO_NATIONAL(OLD_UNOWN_Z),
-    SPECIES_TO_NATIONAL(TREECKO),
-    SPECIES_TO_NATIONAL(GROVYLE),
-    SPECIES_TO_NATIONAL(SCEPTILE),
-    SPECIES_TO_NATIONAL(TORCHIC),
-    SPECIES_TO_NATIONAL(COMBUSKEN),
-    SPECIES_TO_NATIONAL(BLAZIKEN),
-    SPECIES_TO_NATIONAL(MUDKIP),
-    SPECIES_TO_NATIONAL(MARSHTOMP),
-    SPECIES_TO_NATIONAL(SWAMPERT),
-    SPECIES_TO_NATIONAL(POOCHYENA),
-    SPECIES_TO_NATIONAL(MIGHTYENA),
-    SPECIES_TO_NATIONAL(ZIGZAGOON),
-    SPECIES_TO_NATIONAL(LINOONE),
-    SPECIES_TO_NATIONAL(WURMPLE),
-    SPECIES_TO_NATIONAL(SILCOON),
-    SPECIES_TO_NATIONAL(BEAUTIFLY),
-    SPECIES_TO_NATIONAL(CASCOON),
-    SPECIES_TO_NATIONAL(DUSTOX),
-    SPECIES_TO_NATIONAL(LOTAD),
-    SPECIES_TO_NATIONAL(LOMBRE),
-    SPECIES_TO_NATIONAL(LUDICOLO),
-    SPECIES_TO_NATIONAL(SEEDOT),
-    SPECIES_TO_NATIONAL(NUZLEAF),
-    SPECIES_TO_NATIONAL(SHIFTRY),
-    SPECIES_TO_NATIONAL(NINCADA),
-    SPECIES_TO_NATIONAL(NINJASK),
-    SPECIES_TO_NATIONAL(SHEDINJA),
-    SPECIES_TO_NATIONAL(TAILLOW),
-    SPECIES_TO_NATIONAL(SWELLOW),
-    SPECIES_TO_NATIONAL(SHROOMISH),
-    SPECIES_TO_NATIONAL(BRELOOM),
-    SPECIES_TO_NATIONAL(SPINDA),
-    SPECIES_TO_NATIONAL(WINGULL),
-    SPECIES_TO_NATIONAL(PELIPPER),
-    SPECIES_TO_NATIONAL(SURSKIT),
-    SPECIES_TO_NATIONAL(MASQUERAIN),
-    SPECIES_TO_NATIONAL(WAILMER),
-    SPECIES_TO_NATIONAL(WAILORD),
-    SPECIES_TO_NATIONAL(SKITTY),
-    SPECIES_TO_NATIONAL(DELCATTY),
-    SPECIES_TO_NATIONAL(KECLEON),
-    SPECIES_TO_NATIONAL(BALTOY),
-    SPECIES_TO_NATIONAL(CLAYDOL),
-    SPECIES_TO_NATIONAL(NOSEPASS),
-    SPECIES_TO_NATIONAL(TORKOAL),
-    SPECIES_TO_NATIONAL(SABLEYE),
-    SPECIES_TO_NATIONAL(BARBOACH),
-    SPECIES_TO_NATIONAL(WHISCASH),
-    SPECIES_TO_NATIONAL(LUVDISC),
-    SPECIES_TO_NATIONAL(CORPHISH),
-    SPECIES_TO_NATIONAL(CRAWDAUNT),
-    SPECIES_TO_NATIONAL(FEEBAS),
-    SPECIES_TO_NATIONAL(MILOTIC),
-    SPECIES_TO_NATIONAL(CARVANHA),
-    SPECIES_TO_NATIONAL(SHARPEDO),
-    SPECIES_TO_NATIONAL(TRAPINCH),
-    SPECIES_TO_NATIONAL(VIBRAVA),
-    SPECIES_TO_NATIONAL(FLYGON),
-    SPECIES_TO_NATIONAL(MAKUHITA),
-    SPECIES_TO_NATIONAL(HARIYAMA),
-    SPECIES_TO_NATIONAL(ELECTRIKE),
-    SPECIES_TO_NATIONAL(MANECTRIC),
-    SPECIES_TO_NATIONAL(NUMEL),
-    SPECIES_TO_NATIONAL(CAMERUPT),
-    SPECIES_TO_NATIONAL(SPHEAL),
-    SPECIES_TO_NATIONAL(SEALEO),
-    SPECIES_TO_NATIONAL(WALREIN),
-    SPECIES_TO_NATIONAL(CACNEA),
-    SPECIES_TO_NATIONAL(CACTURNE),
-    SPECIES_TO_NATIONAL(SNORUNT),
-    SPECIES_TO_NATIONAL(GLALIE),
-    SPECIES_TO_NATIONAL(LUNATONE),
-    SPECIES_TO_NATIONAL(SOLROCK),
-    SPECIES_TO_NATIONAL(AZURILL),
-    SPECIES_TO_NATIONAL(SPOINK),
-    SPECIES_TO_NATIONAL(GRUMPIG),
-    SPECIES_TO_NATIONAL(PLUSLE),
-    SPECIES_TO_NATIONAL(MINUN),
-    SPECIES_TO_NATIONAL(MAWILE),
-    SPECIES_TO_NATIONAL(MEDITITE),
-    SPECIES_TO_NATIONAL(MEDICHAM),
-    SPECIES_TO_NATIONAL(SWABLU),
-    SPECIES_TO_NATIONAL(ALTARIA),
-    SPECIES_TO_NATIONAL(WYNAUT),
-    SPECIES_TO_NATIONAL(DUSKULL),
-    SPECIES_TO_NATIONAL(DUSCLOPS),
-    SPECIES_TO_NATIONAL(ROSELIA),
-    SPECIES_TO_NATIONAL(SLAKOTH),
-    SPECIES_TO_NATIONAL(VIGOROTH),
-    SPECIES_TO_NATIONAL(SLAKING),
-    SPECIES_TO_NATIONAL(GULPIN),
-    SPECIES_TO_NATIONAL(SWALOT),
-    SPECIES_TO_NATIONAL(TROPIUS),
-    SPECIES_TO_NATIONAL(WHISMUR),
-    SPECIES_TO_NATIONAL(LOUDRED),
-    SPECIES_TO_NATIONAL(EXPLOUD),
-    SPECIES_TO_NATIONAL(CLAMPERL),
-    SPECIES_TO_NATIONAL(HUNTAIL),
-    SPECIES_TO_NATIONAL(GOREBYSS),
-    SPECIES_TO_NATIONAL(ABSOL),
-    SPECIES_TO_NATIONAL(SHUPPET),
-    SPECIES_TO_NATIONAL(BANETTE),
-    SPECIES_TO_NATIONAL(SEVIPER),
-    SPECIES_TO_NATIONAL(ZANGOOSE),
-    SPECIES_TO_NATIONAL(RELICANTH),
-    SPECIES_TO_NATIONAL(ARON),
-    SPECIES_TO_NATIONAL(LAIRON),
-    SPECIES_TO_NATIONAL(AGGRON),
-    SPECIES_TO_NATIONAL(CASTFORM),
-    SPECIES_TO_NATIONAL(VOLBEAT),
-    SPECIES_TO_NATIONAL(ILLUMISE),
-    SPECIES_TO_NATIONAL(LILEEP),
-    SPECIES_TO_NATIONAL(CRADILY),
-    SPECIES_TO_NATIONAL(ANORITH),
-    SPECIES_TO_NATIONAL(ARMALDO),
-    SPECIES_TO_NATIONAL(RALTS),
-    SPECIES_TO_NATIONAL(KIRLIA),
-    SPECIES_TO_NATIONAL(GARDEVOIR),
-    SPECIES_TO_NATIONAL(BAGON),
-    SPECIES_TO_NATIONAL(SHELGON),
-    SPECIES_TO_NATIONAL(SALAMENCE),
-    SPECIES_TO_NATIONAL(BELDUM),
-    SPECIES_TO_NATIONAL(METANG),
-    SPECIES_TO_NATIONAL(METAGROSS),
-    SPECIES_TO_NATIONAL(REGIROCK),
-    SPECIES_TO_NATIONAL(REGICE),
-    SPECIES_TO_NATIONAL(REGISTEEL),
-    SPECIES_TO_NATIONAL(KYOGRE),
-    SPECIES_TO_NATIONAL(GROUDON),
-    SPECIES_TO_NATIONAL(RAYQUAZA),
-    SPECIES_TO_NATIONAL(LATIAS),
-    SPECIES_TO_NATIONAL(LATIOS),
-    SPECIES_TO_NATIONAL(JIRACHI),
-    SPECIES_TO_NATIONAL(DEOXYS),
-    SPECIES_TO_NATIONAL(CHIMECHO),
+    DEX_SPECIES(SPECIES_TO_NATIONAL)
 };
 
 // Assigns all Hoenn Dex Indexes to a National Dex Index
 static const u16 sHoennToNationalOrder[NUM_SPECIES - 1] =
 {
-    HOENN_TO_NATIONAL(TREECKO),
-    HOENN_TO_NATIONAL(GROVYLE),
-    HOENN_TO_NATIONAL(SCEPTILE),
-    HOENN_TO_NATIONAL(TORCHIC),
-    HOENN_TO_NATIONAL(COMBUSKEN),
-    HOENN_TO_NATIONAL(BLAZIKEN),
-    HOENN_TO_NATIONAL(MUDKIP),
-    HOENN_TO_NATIONAL(MARSHTOMP),
-    HOENN_TO_NATIONAL(SWAMPERT),
-    HOENN_TO_NATIONAL(POOCHYENA),
-    HOENN_TO_NATIONAL(MIGHTYENA),
-    HOENN_TO_NATIONAL(ZIGZAGOON),
-    HOENN_TO_NATIONAL(LINOONE),
-    HOENN_TO_NATIONAL(WURMPLE),
-    HOENN_TO_NATIONAL(SILCOON),
-    HOENN_TO_NATIONAL(BEAUTIFLY),
-    HOENN_TO_NATIONAL(CASCOON),
-    HOENN_TO_NATIONAL(DUSTOX),
-    HOENN_TO_NATIONAL(LOTAD),
-    HOENN_TO_NATIONAL(LOMBRE),
-    HOENN_TO_NATIONAL(LUDICOLO),
-    HOENN_TO_NATIONAL(SEEDOT),
-    HOENN_TO_NATIONAL(NUZLEAF),
-    HOENN_TO_NATIONAL(SHIFTRY),
-    HOENN_TO_NATIONAL(TAILLOW),
-    HOENN_TO_NATIONAL(SWELLOW),
-    HOENN_TO_NATIONAL(WINGULL),
-    HOENN_TO_NATIONAL(PELIPPER),
-    HOENN_TO_NATIONAL(RALTS),
-    HOENN_TO_NATIONAL(KIRLIA),
-    HOENN_TO_NATIONAL(GARDEVOIR),
-    HOENN_TO_NATIONAL(SURSKIT),
-    HOENN_TO_NATIONAL(MASQUERAIN),
-    HOENN_TO_NATIONAL(SHROOMISH),
-    HOENN_TO_NATIONAL(BRELOOM),
-    HOENN_TO_NATIONAL(SLAKOTH),
-    HOENN_TO_NATIONAL(VIGOROTH),
-    HOENN_TO_NATIONAL(SLAKING),
-    HOENN_TO_NATIONAL(ABRA),
-    HOENN_TO_NATIONAL(KADABRA),
-    HOENN_TO_NATIONAL(ALAKAZAM),
-    HOENN_TO_NATIONAL(NINCADA),
-    HOENN_TO_NATIONAL(NINJASK),
-    HOENN_TO_NATIONAL(SHEDINJA),
-    HOENN_TO_NATIONAL(WHISMUR),
-    HOENN_TO_NATIONAL(LOUDRED),
-    HOENN_TO_NATIONAL(EXPLOUD),
-    HOENN_TO_NATIONAL(MAKUHITA),
-    HOENN_TO_NATIONAL(HARIYAMA),
-    HOENN_TO_NATIONAL(GOLDEEN),
-    HOENN_TO_NATIONAL(SEAKING),
-    HOENN_TO_NATIONAL(MAGIKARP),
-    HOENN_TO_NATIONAL(GYARADOS),
-    HOENN_TO_NATIONAL(AZURILL),
-    HOENN_TO_NATIONAL(MARILL),
-    HOENN_TO_NATIONAL(AZUMARILL),
-    HOENN_TO_NATIONAL(GEODUDE),
-    HOENN_TO_NATIONAL(GRAVELER),
-    HOENN_TO_NATIONAL(GOLEM),
-    HOENN_TO_NATIONAL(NOSEPASS),
-    HOENN_TO_NATIONAL(SKITTY),
-    HOENN_TO_NATIONAL(DELCATTY),
-    HOENN_TO_NATIONAL(ZUBAT),
-    HOENN_TO_NATIONAL(GOLBAT),
-    HOENN_TO_NATIONAL(CROBAT),
-    HOENN_TO_NATIONAL(TENTACOOL),
-    HOENN_TO_NATIONAL(TENTACRUEL),
-    HOENN_TO_NATIONAL(SABLEYE),
-    HOENN_TO_NATIONAL(MAWILE),
-    HOENN_TO_NATIONAL(ARON),
-    HOENN_TO_NATIONAL(LAIRON),
-    HOENN_TO_NATIONAL(AGGRON),
-    HOENN_TO_NATIONAL(MACHOP),
-    HOENN_TO_NATIONAL(MACHOKE),
-    HOENN_TO_NATIONAL(MACHAMP),
-    HOENN_TO_NATIONAL(MEDITITE),
-    HOENN_TO_NATIONAL(MEDICHAM),
-    HOENN_TO_NATIONAL(ELECTRIKE),
-    HOENN_TO_NATIONAL(MANECTRIC),
-    HOENN_TO_NATIONAL(PLUSLE),
-    HOENN_TO_NATIONAL(MINUN),
-    HOENN_TO_NATIONAL(MAGNEMITE),
-    HOENN_TO_NATIONAL(MAGNETON),
-    HOENN_TO_NATIONAL(VOLTORB),
-    HOENN_TO_NATIONAL(ELECTRODE),
-    HOENN_TO_NATIONAL(VOLBEAT),
-    HOENN_TO_NATIONAL(ILLUMISE),
-    HOENN_TO_NATIONAL(ODDISH),
-    HOENN_TO_NATIONAL(GLOOM),
-    HOENN_TO_NATIONAL(VILEPLUME),
-    HOENN_TO_NATIONAL(BELLOSSOM),
-    HOENN_TO_NATIONAL(DODUO),
-    HOENN_TO_NATIONAL(DODRIO),
-    HOENN_TO_NATIONAL(ROSELIA),
-    HOENN_TO_NATIONAL(GULPIN),
-    HOENN_TO_NATIONAL(SWALOT),
-    HOENN_TO_NATIONAL(CARVANHA),
-    HOENN_TO_NATIONAL(SHARPEDO),
-    HOENN_TO_NATIONAL(WAILMER),
-    HOENN_TO_NATIONAL(WAILORD),
-    HOENN_TO_NATIONAL(NUMEL),
-    HOENN_TO_NATIONAL(CAMERUPT),
-    HOENN_TO_NATIONAL(SLUGMA),
-    HOENN_TO_NATIONAL(MAGCARGO),
-    HOENN_TO_NATIONAL(TORKOAL),
-    HOENN_TO_NATIONAL(GRIMER),
-    HOENN_TO_NATIONAL(MUK),
-    HOENN_TO_NATIONAL(KOFFING),
-    HOENN_TO_NATIONAL(WEEZING),
-    HOENN_TO_NATIONAL(SPOINK),
-    HOENN_TO_NATIONAL(GRUMPIG),
-    HOENN_TO_NATIONAL(SANDSHREW),
-    HOENN_TO_NATIONAL(SANDSLASH),
-    HOENN_TO_NATIONAL(SPINDA),
-    HOENN_TO_NATIONAL(SKARMORY),
-    HOENN_TO_NATIONAL(TRAPINCH),
-    HOENN_TO_NATIONAL(VIBRAVA),
-    HOENN_TO_NATIONAL(FLYGON),
-    HOENN_TO_NATIONAL(CACNEA),
-    HOENN_TO_NATIONAL(CACTURNE),
-    HOENN_TO_NATIONAL(SWABLU),
-    HOENN_TO_NATIONAL(ALTARIA),
-    HOENN_TO_NATIONAL(ZANGOOSE),
-    HOENN_TO_NATIONAL(SEVIPER),
-    HOENN_TO_NATIONAL(LUNATONE),
-    HOENN_TO_NATIONAL(SOLROCK),
-    HOENN_TO_NATIONAL(BARBOACH),
-    HOENN_TO_NATIONAL(WHISCASH),
-    HOENN_TO_NATIONAL(CORPHISH),
-    HOENN_TO_NATIONAL(CRAWDAUNT),
-    HOENN_TO_NATIONAL(BALTOY),
-    HOENN_TO_NATIONAL(CLAYDOL),
-    HOENN_TO_NATIONAL(LILEEP),
-    HOENN_TO_NATIONAL(CRADILY),
-    HOENN_TO_NATIONAL(ANORITH),
-    HOENN_TO_NATIONAL(ARMALDO),
-    HOENN_TO_NATIONAL(IGGLYBUFF),
-    HOENN_TO_NATIONAL(JIGGLYPUFF),
-    HOENN_TO_NATIONAL(WIGGLYTUFF),
-    HOENN_TO_NATIONAL(FEEBAS),
-    HOENN_TO_NATIONAL(MILOTIC),
-    HOENN_TO_NATIONAL(CASTFORM),
-    HOENN_TO_NATIONAL(STARYU),
-    HOENN_TO_NATIONAL(STARMIE),
-    HOENN_TO_NATIONAL(KECLEON),
-    HOENN_TO_NATIONAL(SHUPPET),
-    HOENN_TO_NATIONAL(BANETTE),
-    HOENN_TO_NATIONAL(DUSKULL),
-    HOENN_TO_NATIONAL(DUSCLOPS),
-    HOENN_TO_NATIONAL(TROPIUS),
-    HOENN_TO_NATIONAL(CHIMECHO),
-    HOENN_TO_NATIONAL(ABSOL),
-    HOENN_TO_NATIONAL(VULPIX),
-    HOENN_TO_NATIONAL(NINETALES),
-    HOENN_TO_NATIONAL(PICHU),
-    HOENN_TO_NATIONAL(PIKACHU),
-    HOENN_TO_NATIONAL(RAICHU),
-    HOENN_TO_NATIONAL(PSYDUCK),
-    HOENN_TO_NATIONAL(GOLDUCK),
-    HOENN_TO_NATIONAL(WYNAUT),
-    HOENN_TO_NATIONAL(WOBBUFFET),
-    HOENN_TO_NATIONAL(NATU),
-    HOENN_TO_NATIONAL(XATU),
-    HOENN_TO_NATIONAL(GIRAFARIG),
-    HOENN_TO_NATIONAL(PHANPY),
-    HOENN_TO_NATIONAL(DONPHAN),
-    HOENN_TO_NATIONAL(PINSIR),
-    HOENN_TO_NATIONAL(HERACROSS),
-    HOENN_TO_NATIONAL(RHYHORN),
-    HOENN_TO_NATIONAL(RHYDON),
-    HOENN_TO_NATIONAL(SNORUNT),
-    HOENN_TO_NATIONAL(GLALIE),
-    HOENN_TO_NATIONAL(SPHEAL),
-    HOENN_TO_NATIONAL(SEALEO),
-    HOENN_TO_NATIONAL(WALREIN),
-    HOENN_TO_NATIONAL(CLAMPERL),
-    HOENN_TO_NATIONAL(HUNTAIL),
-    HOENN_TO_NATIONAL(GOREBYSS),
-    HOENN_TO_NATIONAL(RELICANTH),
-    HOENN_TO_NATIONAL(CORSOLA),
-    HOENN_TO_NATIONAL(CHINCHOU),
-    HOENN_TO_NATIONAL(LANTURN),
-    HOENN_TO_NATIONAL(LUVDISC),
-    HOENN_TO_NATIONAL(HORSEA),
-    HOENN_TO_NATIONAL(SEADRA),
-    HOENN_TO_NATIONAL(KINGDRA),
-    HOENN_TO_NATIONAL(BAGON),
-    HOENN_TO_NATIONAL(SHELGON),
-    HOENN_TO_NATIONAL(SALAMENCE),
-    HOENN_TO_NATIONAL(BELDUM),
-    HOENN_TO_NATIONAL(METANG),
-    HOENN_TO_NATIONAL(METAGROSS),
-    HOENN_TO_NATIONAL(REGIROCK),
-    HOENN_TO_NATIONAL(REGICE),
-    HOENN_TO_NATIONAL(REGISTEEL),
-    HOENN_TO_NATIONAL(LATIAS),
-    HOENN_TO_NATIONAL(LATIOS),
-    HOENN_TO_NATIONAL(KYOGRE),
-    HOENN_TO_NATIONAL(GROUDON),
-    HOENN_TO_NATIONAL(RAYQUAZA),
-    HOENN_TO_NATIONAL(JIRACHI),
-    HOENN_TO_NATIONAL(DEOXYS),
-    HOENN_TO_NATIONAL(BULBASAUR), // Pokémon from here onwards are UNSEEN in the HoennDex.
-    HOENN_TO_NATIONAL(IVYSAUR),
-    HOENN_TO_NATIONAL(VENUSAUR),
-    HOENN_TO_NATIONAL(CHARMANDER),
-    HOENN_TO_NATIONAL(CHARMELEON),
-    HOENN_TO_NATIONAL(CHARIZARD),
-    HOENN_TO_NATIONAL(SQUIRTLE),
-    HOENN_TO_NATIONAL(WARTORTLE),
-    HOENN_TO_NATIONAL(BLASTOISE),
-    HOENN_TO_NATIONAL(CATERPIE),
-    HOENN_TO_NATIONAL(METAPOD),
-    HOENN_TO_NATIONAL(BUTTERFREE),
-    HOENN_TO_NATIONAL(WEEDLE),
-    HOENN_TO_NATIONAL(KAKUNA),
-    HOENN_TO_NATIONAL(BEEDRILL),
-    HOENN_TO_NATIONAL(PIDGEY),
-    HOENN_TO_NATIONAL(PIDGEOTTO),
-    HOENN_TO_NATIONAL(PIDGEOT),
-    HOENN_TO_NATIONAL(RATTATA),
-    HOENN_TO_NATIONAL(RATICATE),
-    HOENN_TO_NATIONAL(SPEAROW),
-    HOENN_TO_NATIONAL(FEAROW),
-    HOENN_TO_NATIONAL(EKANS),
-    HOENN_TO_NATIONAL(ARBOK),
-    HOENN_TO_NATIONAL(NIDORAN_F),
-    HOENN_TO_NATIONAL(NIDORINA),
-    HOENN_TO_NATIONAL(NIDOQUEEN),
-    HOENN_TO_NATIONAL(NIDORAN_M),
-    HOENN_TO_NATIONAL(NIDORINO),
-    HOENN_TO_NATIONAL(NIDOKING),
-    HOENN_TO_NATIONAL(CLEFAIRY),
-    HOENN_TO_NATIONAL(CLEFABLE),
-    HOENN_TO_NATIONAL(PARAS),
-    HOENN_TO_NATIONAL(PARASECT),
-    HOENN_TO_NATIONAL(VENONAT),
-    HOENN_TO_NATIONAL(VENOMOTH),
-    HOENN_TO_NATIONAL(DIGLETT),
-    HOENN_TO_NATIONAL(DUGTRIO),
-    HOENN_TO_NATIONAL(MEOWTH),
-    HOENN_TO_NATIONAL(PERSIAN),
-    HOENN_TO_NATIONAL(MANKEY),
-    HOENN_TO_NATIONAL(PRIMEAPE),
-    HOENN_TO_NATIONAL(GROWLITHE),
-    HOENN_TO_NATIONAL(ARCANINE),
-    HOENN_TO_NATIONAL(POLIWAG),
-    HOENN_TO_NATIONAL(POLIWHIRL),
-    HOENN_TO_NATIONAL(POLIWRATH),
-    HOENN_TO_NATIONAL(BELLSPROUT),
-    HOENN_TO_NATIONAL(WEEPINBELL),
-    HOENN_TO_NATIONAL(VICTREEBEL),
-    HOENN_TO_NATIONAL(PONYTA),
-    HOENN_TO_NATIONAL(RAPIDASH),
-    HOENN_TO_NATIONAL(SLOWPOKE),
-    HOENN_TO_NATIONAL(SLOWBRO),
-    HOENN_TO_NATIONAL(FARFETCHD),
-    HOENN_TO_NATIONAL(SEEL),
-    HOENN_TO_NATIONAL(DEWGONG),
-    HOENN_TO_NATIONAL(SHELLDER),
-    HOENN_TO_NATIONAL(CLOYSTER),
-    HOENN_TO_NATIONAL(GASTLY),
-    HOENN_TO_NATIONAL(HAUNTER),
-    HOENN_TO_NATIONAL(GENGAR),
-    HOENN_TO_NATIONAL(ONIX),
-    HOENN_TO_NATIONAL(DROWZEE),
-    HOENN_TO_NATIONAL(HYPNO),
-    HOENN_TO_NATIONAL(KRABBY),
-    HOENN_TO_NATIONAL(KINGLER),
-    HOENN_TO_NATIONAL(EXEGGCUTE),
-    HOENN_TO_NATIONAL(EXEGGUTOR),
-    HOENN_TO_NATIONAL(CUBONE),
-    HOENN_TO_NATIONAL(MAROWAK),
-    HOENN_TO_NATIONAL(HITMONLEE),
-    HOENN_TO_NATIONAL(HITMONCHAN),
-    HOENN_TO_NATIONAL(LICKITUNG),
-    HOENN_TO_NATIONAL(CHANSEY),
-    HOENN_TO_NATIONAL(TANGELA),
-    HOENN_TO_NATIONAL(KANGASKHAN),
-    HOENN_TO_NATIONAL(MR_MIME),
-    HOENN_TO_NATIONAL(SCYTHER),
-    HOENN_TO_NATIONAL(JYNX),
-    HOENN_TO_NATIONAL(ELECTABUZZ),
-    HOENN_TO_NATIONAL(MAGMAR),
-    HOENN_TO_NATIONAL(TAUROS),
-    HOENN_TO_NATIONAL(LAPRAS),
-    HOENN_TO_NATIONAL(DITTO),
-    HOENN_TO_NATIONAL(EEVEE),
-    HOENN_TO_NATIONAL(VAPOREON),
-    HOENN_TO_NATIONAL(JOLTEON),
-    HOENN_TO_NATIONAL(FLAREON),
-    HOENN_TO_NATIONAL(PORYGON),
-    HOENN_TO_NATIONAL(OMANYTE),
-    HOENN_TO_NATIONAL(OMASTAR),
-    HOENN_TO_NATIONAL(KABUTO),
-    HOENN_TO_NATIONAL(KABUTOPS),
-    HOENN_TO_NATIONAL(AERODACTYL),
-    HOENN_TO_NATIONAL(SNORLAX),
-    HOENN_TO_NATIONAL(ARTICUNO),
-    HOENN_TO_NATIONAL(ZAPDOS),
-    HOENN_TO_NATIONAL(MOLTRES),
-    HOENN_TO_NATIONAL(DRATINI),
-    HOENN_TO_NATIONAL(DRAGONAIR),
-    HOENN_TO_NATIONAL(DRAGONITE),
-    HOENN_TO_NATIONAL(MEWTWO),
-    HOENN_TO_NATIONAL(MEW),
-    HOENN_TO_NATIONAL(CHIKORITA),
-    HOENN_TO_NATIONAL(BAYLEEF),
-    HOENN_TO_NATIONAL(MEGANIUM),
-    HOENN_TO_NATIONAL(CYNDAQUIL),
-    HOENN_TO_NATIONAL(QUILAVA),
-    HOENN_TO_NATIONAL(TYPHLOSION),
-    HOENN_TO_NATIONAL(TOTODILE),
-    HOENN_TO_NATIONAL(CROCONAW),
-    HOENN_TO_NATIONAL(FERALIGATR),
-    HOENN_TO_NATIONAL(SENTRET),
-    HOENN_TO_NATIONAL(FURRET),
-    HOENN_TO_NATIONAL(HOOTHOOT),
-    HOENN_TO_NATIONAL(NOCTOWL),
-    HOENN_TO_NATIONAL(LEDYBA),
-    HOENN_TO_NATIONAL(LEDIAN),
-    HOENN_TO_NATIONAL(SPINARAK),
-    HOENN_TO_NATIONAL(ARIADOS),
-    HOENN_TO_NATIONAL(CLEFFA),
-    HOENN_TO_NATIONAL(TOGEPI),
-    HOENN_TO_NATIONAL(TOGETIC),
-    HOENN_TO_NATIONAL(MAREEP),
-    HOENN_TO_NATIONAL(FLAAFFY),
-    HOENN_TO_NATIONAL(AMPHAROS),
-    HOENN_TO_NATIONAL(SUDOWOODO),
-    HOENN_TO_NATIONAL(POLITOED),
-    HOENN_TO_NATIONAL(HOPPIP),
-    HOENN_TO_NATIONAL(SKIPLOOM),
-    HOENN_TO_NATIONAL(JUMPLUFF),
-    HOENN_TO_NATIONAL(AIPOM),
-    HOENN_TO_NATIONAL(SUNKERN),
-    HOENN_TO_NATIONAL(SUNFLORA),
-    HOENN_TO_NATIONAL(YANMA),
-    HOENN_TO_NATIONAL(WOOPER),
-    HOENN_TO_NATIONAL(QUAGSIRE),
-    HOENN_TO_NATIONAL(ESPEON),
-    HOENN_TO_NATIONAL(UMBREON),
-    HOENN_TO_NATIONAL(MURKROW),
-    HOENN_TO_NATIONAL(SLOWKING),
-    HOENN_TO_NATIONAL(MISDREAVUS),
-    HOENN_TO_NATIONAL(UNOWN),
-    HOENN_TO_NATIONAL(PINECO),
-    HOENN_TO_NATIONAL(FORRETRESS),
-    HOENN_TO_NATIONAL(DUNSPARCE),
-    HOENN_TO_NATIONAL(GLIGAR),
-    HOENN_TO_NATIONAL(STEELIX),
-    HOENN_TO_NATIONAL(SNUBBULL),
-    HOENN_TO_NATIONAL(GRANBULL),
-    HOENN_TO_NATIONAL(QWILFISH),
-    HOENN_TO_NATIONAL(SCIZOR),
-    HOENN_TO_NATIONAL(SHUCKLE),
-    HOENN_TO_NATIONAL(SNEASEL),
-    HOENN_TO_NATIONAL(TEDDIURSA),
-    HOENN_TO_NATIONAL(URSARING),
-    HOENN_TO_NATIONAL(SWINUB),
-    HOENN_TO_NATIONAL(PILOSWINE),
-    HOENN_TO_NATIONAL(REMORAID),
-    HOENN_TO_NATIONAL(OCTILLERY),
-    HOENN_TO_NATIONAL(DELIBIRD),
-    HOENN_TO_NATIONAL(MANTINE),
-    HOENN_TO_NATIONAL(HOUNDOUR),
-    HOENN_TO_NATIONAL(HOUNDOOM),
-    HOENN_TO_NATIONAL(PORYGON2),
-    HOENN_TO_NATIONAL(STANTLER),
-    HOENN_TO_NATIONAL(SMEARGLE),
-    HOENN_TO_NATIONAL(TYROGUE),
-    HOENN_TO_NATIONAL(HITMONTOP),
-    HOENN_TO_NATIONAL(SMOOCHUM),
-    HOENN_TO_NATIONAL(ELEKID),
-    HOENN_TO_NATIONAL(MAGBY),
-    HOENN_TO_NATIONAL(MILTANK),
-    HOENN_TO_NATIONAL(BLISSEY),
-    HOENN_TO_NATIONAL(RAIKOU),
-    HOENN_TO_NATIONAL(ENTEI),
-    HOENN_TO_NATIONAL(SUICUNE),
-    HOENN_TO_NATIONAL(LARVITAR),
-    HOENN_TO_NATIONAL(PUPITAR),
-    HOENN_TO_NATIONAL(TYRANITAR),
-    HOENN_TO_NATIONAL(LUGIA),
-    HOENN_TO_NATIONAL(HO_OH),
-    HOENN_TO_NATIONAL(CELEBI),
-    HOENN_TO_NATIONAL(OLD_UNOWN_B),
-    HOENN_TO_NATIONAL(OLD_UNOWN_C),
-    HOENN_TO_NATIONAL(OLD_UNOWN_D),
-    HOENN_TO_NATIONAL(OLD_UNOWN_E),
-    HOENN_TO_NATIONAL(OLD_UNOWN_F),
-    HOENN_TO_NATIONAL(OLD_UNOWN_G),
-    HOENN_TO_NATIONAL(OLD_UNOWN_H),
-    HOENN_TO_NATIONAL(OLD_UNOWN_I),
-    HOENN_TO_NATIONAL(OLD_UNOWN_J),
-    HOENN_TO_NATIONAL(OLD_UNOWN_K),
-    HOENN_TO_NATIONAL(OLD_UNOWN_L),
-    HOENN_TO_NATIONAL(OLD_UNOWN_M),
-    HOENN_TO_NATIONAL(OLD_UNOWN_N),
-    HOENN_TO_NATIONAL(OLD_UNOWN_O),
-    HOENN_TO_NATIONAL(OLD_UNOWN_P),
-    HOENN_TO_NATIONAL(OLD_UNOWN_Q),
-    HOENN_TO_NATIONAL(OLD_UNOWN_R),
-    HOENN_TO_NATIONAL(OLD_UNOWN_S),
-    HOENN_TO_NATIONAL(OLD_UNOWN_T),
-    HOENN_TO_NATIONAL(OLD_UNOWN_U),
-    HOENN_TO_NATIONAL(OLD_UNOWN_V),
-    HOENN_TO_NATIONAL(OLD_UNOWN_W),
-    HOENN_TO_NATIONAL(OLD_UNOWN_X),
-    HOENN_TO_NATIONAL(OLD_UNOWN_Y),
-    HOENN_TO_NATIONAL(OLD_UNOWN_Z),
+    DEX_SPECIES(HOENN_TO_NATIONAL)
+};
+
+// Assigns all National Dex Indexes to a species
+static const u16 sNationalPokedexNumToSpecies[NUM_SPECIES - 1] =
+{
+    DEX_SPECIES(NATIONAL_TO_SPECIES)
+};
+
+// Assigns all Hoenn Dex Indexes to a species
+static const u16 sHoennPokedexNumToSpecies[NUM_SPECIES - 1] =
+{
+    DEX_SPECIES(HOENN_TO_SPECIES)
+};
+
+// Assigns all National Dex Indexes to a Hoenn Dex Index
+static const u16 sNationalToHoennOrder[NUM_SPECIES - 1] =
+{
+    DEX_SPECIES(NATIONAL_TO_HOENN)
 };
 
 const struct SpindaSpot gSpindaSpotGraphics[] =
@@ -5595,56 +4802,26 @@ u16 GetEvolutionTargetSpecies(struct Pokemon *mon, u8 mode, u16 evolutionItem)
 
 u16 HoennPokedexNumToSpecies(u16 hoennNum)
 {
-    u16 species;
-
-    if (!hoennNum)
-        return 0;
-
-    species = 0;
-
-    while (species < (NUM_SPECIES - 1) && sSpeciesToHoennPokedexNum[species] != hoennNum)
-        species++;
-
-    if (species == NUM_SPECIES - 1)
+    if (!hoennNum || hoennNum >= NUM_SPECIES)
         return 0;
 
-    return species + 1;
+    return sHoennPokedexNumToSpecies[hoennNum - 1];
 }
 
 u16 NationalPokedexNumToSpecies(u16 nationalNum)
 {
-    u16 species;
-
-    if (!nationalNum)
-        return 0;
-
-    species = 0;
-
-    while (species < (NUM_SPECIES - 1) && sSpeciesToNationalPokedexNum[species] != nationalNum)
-        species++;
-
-    if (species == NUM_SPECIES - 1)
+    if (!nationalNum || nationalNum >= NUM_SPECIES)
         return 0;
 
-    return species + 1;
+    return sNationalPokedexNumToSpecies[nationalNum - 1];
 }
 
 u16 NationalToHoennOrder(u16 nationalNum)
 {
-    u16 hoennNum;
-
-    if (!nationalNum)
-        return 0;
-
-    hoennNum = 0;
-
-    while (hoennNum < (NUM_SPECIES - 1) && sHoennToNationalOrder[hoennNum] != nationalNum)
-        hoennNum++;
-
-    if (hoennNum == NUM_SPECIES - 1)
+    if (!nationalNum || nationalNum >= NUM_SPECIES)
         return 0;
 
-    return hoennNum + 1;
+    return sNationalToHoennOrder[nationalNum - 1];
 }
 
 u16 SpeciesToNationalPokedexNum(u16 species)
@@ -92,6 +92,9 @@ EWRAM_DATA static u8 sRecordMixFriendClass = 0;
 EWRAM_DATA static u8 sApprenticeId = 0;
 EWRAM_DATA static u16 sEasyChatSpeech[EASY_CHAT_BATTLE_WORDS_COUNT] = {0};
 EWRAM_DATA static u8 sBattleOutcome = 0;
+EWRAM_DATA static bool8 sHeadlessPlayback = FALSE;
+EWRAM_DATA static u32 sPlaybackStartFrame = 0;
+EWRAM_DATA u32 gRecordedBattlePlaybackFrames = 0;
 
 static u8 sRecordMixFriendLanguage;
 static u8 sApprenticeLanguage;
@@ -498,6 +501,8 @@ static bool32 CopyRecordedBattleFromSave(struct RecordedBattleSave *dst)
 
 static void CB2_RecordedBattleEnd(void)
 {
+    gRecordedBattlePlaybackFrames = gMain.vblankCounter1 - sPlaybackStartFrame;
+    sHeadlessPlayback = FALSE;
     gSaveBlock2Ptr->frontier.lvlMode = sLvlMode;
     gBattleOutcome = 0;
     gBattleTypeFlags = 0;
@@ -515,6 +520,7 @@ static void Task_StartAfterCountdown(u8 taskId)
 {
     if (--gTasks[taskId].tFramesToWait == 0)
     {
+        sPlaybackStartFrame = gMain.vblankCounter1;
         gMain.savedCallback = CB2_RecordedBattleEnd;
         SetMainCallback2(CB2_InitBattle);
         DestroyTask(taskId);
@@ -612,6 +618,55 @@ static void CB2_RecordedBattle(void)
     RunTasks();
 }
 
+// Headless playback replays the recorded battle without waiting on the battle's
+// presentation: move and status animations, text, health bar updates and sounds
+// are skipped by the recorded controllers, and the battle runs several steps per
+// frame. The outcome is the same as a normal playback, which makes it useful for
+// checking that changes to the battle engine and AI don't alter recorded battles,
+// and gRecordedBattlePlaybackFrames gives a rough measure of how long one took.
+// Set it before calling PlayRecordedBattle; it's cleared when the playback ends.
+void RecordedBattle_SetHeadlessPlayback(bool8 headless)
+{
+    sHeadlessPlayback = headless;
+}
+
+bool8 RecordedBattle_IsHeadlessPlayback(void)
+{
+    return sHeadlessPlayback;
+}
+
+// The commands skipped in headless playback only affect what's shown and heard.
+// Commands that create or destroy sprites are still run, so that the sprites the
+// controllers keep track of stay consistent. CONTROLLER_PRINTSTRING isn't skipped
+// here because buffering the string restores the battle message state, and the
+// opponent controller deducts Battle Arena skill points for it. The controllers
+// skip printing it themselves.
+static const bool8 sSkippedInHeadlessPlayback[CONTROLLER_CMDS_COUNT] =
+{
+    [CONTROLLER_PAUSE]                 = TRUE,
+    [CONTROLLER_MOVEANIMATION]         = TRUE,
+    [CONTROLLER_PRINTSTRINGPLAYERONLY] = TRUE,
+    [CONTROLLER_HEALTHBARUPDATE]       = TRUE,
+    [CONTROLLER_STATUSICONUPDATE]      = TRUE,
+    [CONTROLLER_STATUSANIMATION]       = TRUE,
+    [CONTROLLER_PLAYBGM]               = TRUE,
+    [CONTROLLER_HITANIMATION]          = TRUE,
+    [CONTROLLER_PLAYSE]                = TRUE,
+    [CONTROLLER_PLAYFANFAREORBGM]      = TRUE,
+    [CONTROLLER_FAINTINGCRY]           = TRUE,
+    [CONTROLLER_SPRITEINVISIBILITY]    = TRUE,
+    [CONTROLLER_BATTLEANIMATION]       = TRUE,
+    [CONTROLLER_LINKSTANDBYMSG]        = TRUE,
+};
+
+bool32 RecordedBattle_SkipControllerCmd(u8 cmd)
+{
+    if (!sHeadlessPlayback || cmd >= CONTROLLER_CMDS_COUNT)
+        return FALSE;
+
+    return sSkippedInHeadlessPlayback[cmd];
+}
+
 u8 GetRecordedBattleFrontierFacility(void)
 {
     return sFrontierFacility;
@@ -2,6 +2,7 @@
 #include "agb_flash.h"
 #include "gba/flash_internal.h"
 #include "fieldmap.h"
+#include "item.h"
 #include "save.h"
 #include "task.h"
 #include "decompress.h"
@@ -19,6 +20,7 @@ static u8 GetSaveValidStatus(const struct SaveSectorLocation *);
 static u8 CopySaveSlotData(u16, struct SaveSectorLocation *);
 static u8 TryWriteSector(u8, u8 *);
 static u8 HandleWriteSector(u16, const struct SaveSectorLocation *);
+static u8 WriteChangedSaveSectors(const struct SaveSectorLocation *);
 static u8 HandleReplaceSector(u16, const struct SaveSectorLocation *);
 
 // Divide save blocks into individual chunks to be written to flash sectors
@@ -39,6 +41,10 @@ static u8 HandleReplaceSector(u16, const struct SaveSectorLocation *);
  * might be done to reduce wear on the flash memory, but I'm not sure, since all
  * 14 sectors get written anyway.
  *
+ * A normal save only rewrites the sectors whose data differs from what the
+ * slot being overwritten already holds (see WriteChangedSaveSectors). The other
+ * slot is left untouched either way, so a failed save can still fall back to it.
+ *
  * See SECTOR_ID_* constants in save.h
  */
 
@@ -96,6 +102,17 @@ COMMON_DATA u16 gSaveAttemptStatus = 0;
 EWRAM_DATA struct SaveSector gSaveDataBuffer = {0}; // Buffer used for reading/writing sectors
 EWRAM_DATA static u8 sUnusedVar = 0;
 
+// CalculateChecksum runs over every sector on every save and load. When this is TRUE
+// it uses an ARM routine copied to IWRAM, otherwise it uses an unrolled loop in ROM.
+#define CHECKSUM_IN_IWRAM TRUE
+
+#if CHECKSUM_IN_IWRAM
+u32 SumSaveWords_Arm(const u32 *data, u32 numWords);
+
+static u32 sSumSaveWordsRAM_Buffer[0x20];
+static bool8 sSumSaveWordsRAM_Loaded;
+#endif
+
 void ClearSaveData(void)
 {
     u16 i;
@@ -174,6 +191,105 @@ static u8 WriteSaveSectorOrSlot(u16 sectorId, const struct SaveSectorLocation *l
     return status;
 }
 
+// Reads the save slot that the next save will overwrite, and sets a bit in *changedSectors for each
+// sector id whose data differs from the data in RAM. Returns FALSE if the slot is empty, damaged,
+// or not laid out as a rotation of the sector ids, in which case it has to be written in full.
+static bool8 GetChangedSaveSectors(const struct SaveSectorLocation *locations, u32 *changedSectors, u16 *rotation)
+{
+    u16 i, j;
+    u16 id, size;
+    u16 slotOffset = NUM_SECTORS_PER_SLOT * ((gSaveCounter + 1) % NUM_SAVE_SLOTS);
+    u8 sectorIds[NUM_SECTORS_PER_SLOT];
+    u32 foundSectors = 0;
+
+    *changedSectors = 0;
+    *rotation = 0;
+
+    for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
+    {
+        ReadFlashSector(i + slotOffset, gReadWriteSector);
+
+        id = gReadWriteSector->id;
+        if (gReadWriteSector->signature != SECTOR_SIGNATURE
+         || id >= NUM_SECTORS_PER_SLOT
+         || (foundSectors & (1 << id)))
+            return FALSE;
+
+        foundSectors |= 1 << id;
+        sectorIds[i] = id;
+        if (id == 0)
+            *rotation = i;
+
+        // Flash data that matches RAM is only reusable if its checksum is intact.
+        size = locations[id].size;
+        for (j = 0; j < size; j++)
+        {
+            if (gReadWriteSector->data[j] != ((u8 *)locations[id].data)[j])
+                break;
+        }
+        if (j != size || gReadWriteSector->checksum != CalculateChecksum(locations[id].data, size))
+            *changedSectors |= 1 << id;
+    }
+
+    // HandleWriteSector places sector id i at (i + gLastWrittenSector) % NUM_SECTORS_PER_SLOT
+    for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
+    {
+        if (sectorIds[i] != (i + NUM_SECTORS_PER_SLOT - *rotation) % NUM_SECTORS_PER_SLOT)
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+// Writes a full save slot, but only programs the sectors that changed since the slot being
+// overwritten was last written. The sectors aren't rotated, so each one keeps its position.
+static u8 WriteChangedSaveSectors(const struct SaveSectorLocation *locations)
+{
+    u32 changedSectors;
+    u16 rotation;
+    u16 lastSectorId;
+    u16 i;
+    u8 status;
+
+    gReadWriteSector = &gSaveDataBuffer;
+
+    if (!GetChangedSaveSectors(locations, &changedSectors, &rotation))
+        return WriteSaveSectorOrSlot(FULL_SAVE_SLOT, locations);
+
+    gLastKnownGoodSector = gLastWrittenSector;
+    gLastSaveCounter = gSaveCounter;
+    gLastWrittenSector = rotation;
+    gSaveCounter++;
+    status = SAVE_STATUS_OK;
+
+    // GetSaveValidStatus takes a slot's save counter from its last sector, so that sector is
+    // always written, and written last. Until then the slot still reads as the older save.
+    lastSectorId = (NUM_SECTORS_PER_SLOT - 1 + NUM_SECTORS_PER_SLOT - rotation) % NUM_SECTORS_PER_SLOT;
+    changedSectors |= 1 << lastSectorId;
+
+    for (i = 0; i < NUM_SECTORS_PER_SLOT; i++)
+    {
+        if (i == lastSectorId)
+            continue;
+
+        if (changedSectors & (1 << i))
+            HandleWriteSector(i, locations);
+        else // Unchanged sector, its flash copy is still good
+            SetDamagedSectorBits(DISABLE, (i + rotation) % NUM_SECTORS_PER_SLOT + NUM_SECTORS_PER_SLOT * (gSaveCounter % NUM_SAVE_SLOTS));
+    }
+    HandleWriteSector(lastSectorId, locations);
+
+    if (gDamagedSaveSectors)
+    {
+        // At least one sector save failed
+        status = SAVE_STATUS_ERROR;
+        gLastWrittenSector = gLastKnownGoodSector;
+        gSaveCounter = gLastSaveCounter;
+    }
+
+    return status;
+}
+
 static u8 HandleWriteSector(u16 sectorId, const struct SaveSectorLocation *locations)
 {
     u16 i;
@@ -674,14 +790,30 @@ static bool8 ReadFlashSector(u8 sectorId, struct SaveSector *sector)
 
 static u16 CalculateChecksum(void *data, u16 size)
 {
-    u16 i;
     u32 checksum = 0;
+    const u32 *words = data;
+#if !CHECKSUM_IN_IWRAM
+    u16 i;
+#endif
 
-    for (i = 0; i < (size / 4); i++)
+#if CHECKSUM_IN_IWRAM
+    if (!sSumSaveWordsRAM_Loaded)
     {
-        checksum += *((u32 *)data);
-        data += sizeof(u32);
+        CpuCopy32((void *)SumSaveWords_Arm, sSumSaveWordsRAM_Buffer, sizeof(sSumSaveWordsRAM_Buffer));
+        sSumSaveWordsRAM_Loaded = TRUE;
     }
+    checksum = ((u32 (*)(const u32 *, u32))sSumSaveWordsRAM_Buffer)(words, size / 4);
+#else
+    // Sum 8 words per iteration. Only the total matters, so this is the same as summing them one at a time.
+    for (i = size / 32; i != 0; i--)
+    {
+        checksum += words[0] + words[1] + words[2] + words[3]
+                  + words[4] + words[5] + words[6] + words[7];
+        words += 8;
+    }
+    for (i = (size / 4) % 8; i != 0; i--)
+        checksum += *(words++);
+#endif
 
     return ((checksum >> 16) + checksum);
 }
@@ -737,7 +869,7 @@ u8 HandleSavingData(u8 saveType)
     case SAVE_NORMAL:
     default:
         CopyPartyAndObjectsToSave();
-        WriteSaveSectorOrSlot(FULL_SAVE_SLOT, gRamSaveSectorLocations);
+        WriteChangedSaveSectors(gRamSaveSectorLocations);
         break;
     case SAVE_LINK:
     case SAVE_EREADER: // Dummied, now duplicate of SAVE_LINK
@@ -886,6 +1018,7 @@ u8 LoadGameSave(u8 saveType)
     default:
         status = TryLoadSaveSlot(FULL_SAVE_SLOT, gRamSaveSectorLocations);
         CopyPartyAndObjectsFromSave();
+        InvalidateBagItemIndex();
         gSaveFileStatus = status;
         gGameContinueCallback = 0;
         break;
@@ -0,0 +1,46 @@
+	.include "asm/macros.inc"
+
+	.syntax unified
+
+	.text
+
+@ u32 SumSaveWords_Arm(const u32 *data, u32 numWords)
+@ Returns the sum of numWords words at data, wrapping at 32 bits. Used by
+@ CalculateChecksum in save.c, which copies it to IWRAM, so it must only
+@ use pc-relative branches.
+	arm_func_start SumSaveWords_Arm
+SumSaveWords_Arm:
+	push {r4-r10}
+	mov r2, 0
+	subs r1, r1, 8
+	blo SumSaveWords_Arm_Remainder
+SumSaveWords_Arm_Loop8:
+	ldmia r0!, {r3-r10}
+	add r2, r2, r3
+	add r2, r2, r4
+	add r2, r2, r5
+	add r2, r2, r6
+	add r2, r2, r7
+	add r2, r2, r8
+	add r2, r2, r9
+	add r2, r2, r10
+	subs r1, r1, 8
+	bhs SumSaveWords_Arm_Loop8
+SumSaveWords_Arm_Remainder:
+	adds r1, r1, 8
+	beq SumSaveWords_Arm_End
+SumSaveWords_Arm_Loop1:
+	ldr r3, [r0], 4
+	add r2, r2, r3
+	subs r1, r1, 1
+	bne SumSaveWords_Arm_Loop1
+SumSaveWords_Arm_End:
+	mov r0, r2
+	pop {r4-r10}
+	bx lr
+	arm_func_end SumSaveWords_Arm
+
+	@ Must fit in sSumSaveWordsRAM_Buffer in save.c
+	.if . - SumSaveWords_Arm > 0x80
+	.error "SumSaveWords_Arm is too large for its IWRAM buffer"
+	.endif
@@ -1,6 +1,7 @@
 #include "global.h"
 #include "battle.h"
 #include "data.h"
+#include "main.h"
 #include "task.h"
 #include "trig.h"
 #include "scanline_effect.h"
@@ -8,6 +9,24 @@
 static void CopyValue16Bit(void);
 static void CopyValue32Bit(void);
 
+void ScanlineEffect_HBlankBg123Hofs_Arm(void);
+void ScanlineEffect_HBlankBg123HofsVisible_Arm(void);
+void ScanlineEffect_HBlankBg123Vofs_Arm(void);
+void ScanlineEffect_HBlankBg0Vofs_Arm(void);
+void ScanlineEffect_HBlankBldy_Arm(void);
+
+static u32 sScanlineHBlankRAM_Buffer[0x2C];
+static bool8 sScanlineHBlankRAM_Loaded;
+
+static const IntrCallback sHBlankCallbacks_Arm[] =
+{
+    [SCANLINE_HBLANK_BG123_HOFS]         = ScanlineEffect_HBlankBg123Hofs_Arm,
+    [SCANLINE_HBLANK_BG123_HOFS_VISIBLE] = ScanlineEffect_HBlankBg123HofsVisible_Arm,
+    [SCANLINE_HBLANK_BG123_VOFS]         = ScanlineEffect_HBlankBg123Vofs_Arm,
+    [SCANLINE_HBLANK_BG0_VOFS]           = ScanlineEffect_HBlankBg0Vofs_Arm,
+    [SCANLINE_HBLANK_BLDY]               = ScanlineEffect_HBlankBldy_Arm,
+};
+
 // EWRAM vars
 
 // Per-scanline register values.
@@ -97,11 +116,12 @@ void ScanlineEffect_InitHBlankDmaTransfer(void)
 
 // These two functions are used to copy the register for the first scanline,
 // depending whether it is a 16-bit register or a 32-bit register.
+// The value for the first scanline is the one just before the DMA source.
 
 static void CopyValue16Bit(void)
 {
     vu16 *dest = (vu16 *)gScanlineEffect.dmaDest;
-    vu16 *src = (vu16 *)&gScanlineEffectRegBuffers[gScanlineEffect.srcBuffer];
+    vu16 *src = (vu16 *)gScanlineEffect.dmaSrcBuffers[gScanlineEffect.srcBuffer] - 1;
 
     *dest = *src;
 }
@@ -109,11 +129,23 @@ static void CopyValue16Bit(void)
 static void CopyValue32Bit(void)
 {
     vu32 *dest = (vu32 *)gScanlineEffect.dmaDest;
-    vu32 *src = (vu32 *)&gScanlineEffectRegBuffers[gScanlineEffect.srcBuffer];
+    vu32 *src = (vu32 *)gScanlineEffect.dmaSrcBuffers[gScanlineEffect.srcBuffer] - 1;
 
     *dest = *src;
 }
 
+// Returns an HBlank callback that sets registers to the current scanline's value in
+// gScanlineEffectRegBuffers[1]. They run from IWRAM, since they're called for every scanline.
+IntrCallback ScanlineEffect_GetHBlankCallback(u8 id)
+{
+    if (!sScanlineHBlankRAM_Loaded)
+    {
+        CpuCopy32((void *)ScanlineEffect_HBlankBg123Hofs_Arm, sScanlineHBlankRAM_Buffer, sizeof(sScanlineHBlankRAM_Buffer));
+        sScanlineHBlankRAM_Loaded = TRUE;
+    }
+    return (IntrCallback)((u8 *)sScanlineHBlankRAM_Buffer + ((u8 *)sHBlankCallbacks_Arm[id] - (u8 *)sHBlankCallbacks_Arm[0]));
+}
+
 #define tStartLine            data[0]
 #define tEndLine              data[1]
 #define tWaveLength           data[2]
@@ -166,9 +198,16 @@ static void TaskFunc_UpdateWavePerFrame(u8 taskId)
                 break;
             }
         }
-        if (gTasks[taskId].tFramesUntilMove != 0)
+        if (!gTasks[taskId].tApplyBattleBgOffsets
+            && gTasks[taskId].tStartLine == 0
+            && gTasks[taskId].tEndLine >= DISPLAY_HEIGHT)
+        {
+            // The wave covers the whole screen and nothing is added to it, so the DMA
+            // can read it straight out of the wave table instead of copying it over.
+            gScanlineEffect.dmaSrcBuffers[gScanlineEffect.srcBuffer] = &gScanlineEffectRegBuffers[0][gTasks[taskId].tSrcBufferOffset + 320 + 1];
+        }
+        else
         {
-            gTasks[taskId].tFramesUntilMove--;
             offset = gTasks[taskId].tSrcBufferOffset + 320;
             for (i = gTasks[taskId].tStartLine; i < gTasks[taskId].tEndLine; i++)
             {
@@ -176,15 +215,14 @@ static void TaskFunc_UpdateWavePerFrame(u8 taskId)
                 offset++;
             }
         }
+
+        if (gTasks[taskId].tFramesUntilMove != 0)
+        {
+            gTasks[taskId].tFramesUntilMove--;
+        }
         else
         {
             gTasks[taskId].tFramesUntilMove = gTasks[taskId].tDelayInterval;
-            offset = gTasks[taskId].tSrcBufferOffset + 320;
-            for (i = gTasks[taskId].tStartLine; i < gTasks[taskId].tEndLine; i++)
-            {
-                gScanlineEffectRegBuffers[gScanlineEffect.srcBuffer][i] = gScanlineEffectRegBuffers[0][offset] + value;
-                offset++;
-            }
 
             // increment src buffer offset
             gTasks[taskId].tSrcBufferOffset++;
@@ -0,0 +1,87 @@
+	.include "asm/macros.inc"
+	.include "constants/gba_constants.inc"
+
+	.syntax unified
+
+	.text
+
+@ HBlank callbacks that set video registers to the value for the current scanline
+@ in gScanlineEffectRegBuffers[1]. ScanlineEffect_GetHBlankCallback in
+@ scanline_effect.c copies all of them to IWRAM together, so they must only use
+@ pc-relative branches and literals.
+
+@ Sets BG1HOFS, BG2HOFS and BG3HOFS.
+	arm_func_start ScanlineEffect_HBlankBg123Hofs_Arm
+ScanlineEffect_HBlankBg123Hofs_Arm:
+	mov r0, REG_BASE
+	ldrh r1, [r0, OFFSET_REG_VCOUNT]
+	ldr r2, ScanlineEffect_HBlank_Arm_RegBuffer
+	mov r1, r1, lsl 1
+	ldrh r1, [r2, r1]
+	strh r1, [r0, OFFSET_REG_BG1HOFS]
+	strh r1, [r0, OFFSET_REG_BG2HOFS]
+	strh r1, [r0, OFFSET_REG_BG3HOFS]
+	bx lr
+	arm_func_end ScanlineEffect_HBlankBg123Hofs_Arm
+
+@ Same as ScanlineEffect_HBlankBg123Hofs_Arm, but leaves the registers alone
+@ during VBlank.
+	arm_func_start ScanlineEffect_HBlankBg123HofsVisible_Arm
+ScanlineEffect_HBlankBg123HofsVisible_Arm:
+	mov r0, REG_BASE
+	ldrh r1, [r0, OFFSET_REG_VCOUNT]
+	cmp r1, VCOUNT_VBLANK
+	bxhs lr
+	ldr r2, ScanlineEffect_HBlank_Arm_RegBuffer
+	mov r1, r1, lsl 1
+	ldrh r1, [r2, r1]
+	strh r1, [r0, OFFSET_REG_BG1HOFS]
+	strh r1, [r0, OFFSET_REG_BG2HOFS]
+	strh r1, [r0, OFFSET_REG_BG3HOFS]
+	bx lr
+	arm_func_end ScanlineEffect_HBlankBg123HofsVisible_Arm
+
+@ Sets BG1VOFS, BG2VOFS and BG3VOFS.
+	arm_func_start ScanlineEffect_HBlankBg123Vofs_Arm
+ScanlineEffect_HBlankBg123Vofs_Arm:
+	mov r0, REG_BASE
+	ldrh r1, [r0, OFFSET_REG_VCOUNT]
+	ldr r2, ScanlineEffect_HBlank_Arm_RegBuffer
+	mov r1, r1, lsl 1
+	ldrh r1, [r2, r1]
+	strh r1, [r0, OFFSET_REG_BG1VOFS]
+	strh r1, [r0, OFFSET_REG_BG2VOFS]
+	strh r1, [r0, OFFSET_REG_BG3VOFS]
+	bx lr
+	arm_func_end ScanlineEffect_HBlankBg123Vofs_Arm
+
+@ Sets BG0VOFS.
+	arm_func_start ScanlineEffect_HBlankBg0Vofs_Arm
+ScanlineEffect_HBlankBg0Vofs_Arm:
+	mov r0, REG_BASE
+	ldrh r1, [r0, OFFSET_REG_VCOUNT]
+	ldr r2, ScanlineEffect_HBlank_Arm_RegBuffer
+	mov r1, r1, lsl 1
+	ldrh r1, [r2, r1]
+	strh r1, [r0, OFFSET_REG_BG0VOFS]
+	bx lr
+	arm_func_end ScanlineEffect_HBlankBg0Vofs_Arm
+
+@ Sets BLDY.
+	arm_func_start ScanlineEffect_HBlankBldy_Arm
+ScanlineEffect_HBlankBldy_Arm:
+	mov r0, REG_BASE
+	ldrh r1, [r0, OFFSET_REG_VCOUNT]
+	ldr r2, ScanlineEffect_HBlank_Arm_RegBuffer
+	mov r1, r1, lsl 1
+	ldrh r1, [r2, r1]
+	strh r1, [r0, OFFSET_REG_BLDY]
+	bx lr
+	arm_func_end ScanlineEffect_HBlankBldy_Arm
+
+ScanlineEffect_HBlank_Arm_RegBuffer: .word gScanlineEffectRegBuffers + 0x3C0 * 2
+
+	@ Must fit in sScanlineHBlankRAM_Buffer in scanline_effect.c
+	.if . - ScanlineEffect_HBlankBg123Hofs_Arm > 0xB0
+	.error "The scanline effect HBlank callbacks are too large for their IWRAM buffer"
+	.endif
@@ -69,10 +69,6 @@ extern const u8 *gStdScripts_End[];
 
 static void CloseBrailleWindow(void);
 
-// This is defined in here so the optimizer can't see its value when compiling
-// script.c.
-void *const gNullScriptPtr = NULL;
-
 static const u8 sScriptConditionTable[6][3] =
 {
 //  <  =  >
@@ -101,6 +97,14 @@ bool8 ScrCmd_nop1(struct ScriptContext *ctx)
     return FALSE;
 }
 
+// Fills the rest of gScriptCmdTable, so that any opcode can be looked up in it
+// without checking against gScriptCmdTableEnd.
+bool8 ScrCmd_invalid(struct ScriptContext *ctx)
+{
+    StopScript(ctx);
+    return FALSE;
+}
+
 bool8 ScrCmd_end(struct ScriptContext *ctx)
 {
     StopScript(ctx);
@@ -1,6 +1,7 @@
 #include "global.h"
 #include "script.h"
 #include "event_data.h"
+#include "main.h"
 #include "mystery_gift.h"
 #include "util.h"
 #include "constants/event_objects.h"
@@ -8,6 +9,14 @@
 
 #define RAM_SCRIPT_MAGIC 51
 
+// When this is TRUE, contexts whose command table covers every opcode run their
+// commands from an ARM loop copied to IWRAM, otherwise they use the loop in ROM.
+#define SCRIPT_LOOP_IN_IWRAM TRUE
+
+// When this is TRUE, every command run counts towards gScriptCmdProfile, which
+// can be read from a debugger.
+#define PROFILE_SCRIPT_CMDS FALSE
+
 enum {
     SCRIPT_MODE_STOPPED,
     SCRIPT_MODE_BYTECODE,
@@ -29,7 +38,19 @@ static bool8 sLockFieldControls;
 
 extern ScrCmdFunc gScriptCmdTable[];
 extern ScrCmdFunc gScriptCmdTableEnd[];
-extern void *const gNullScriptPtr;
+
+#if SCRIPT_LOOP_IN_IWRAM
+bool8 RunScriptCommands_Arm(struct ScriptContext *ctx, ScrCmdFunc *cmdTable);
+
+STATIC_ASSERT(offsetof(struct ScriptContext, scriptPtr) == 8, ScriptPtrOffsetUsedByRunScriptCommands_Arm);
+
+static u32 sRunScriptCommandsRAM_Buffer[0x18];
+static bool8 sRunScriptCommandsRAM_Loaded;
+#endif
+
+#if PROFILE_SCRIPT_CMDS
+EWRAM_DATA struct ScriptCmdProfile gScriptCmdProfile[0x100] = {0};
+#endif
 
 void InitScriptContext(struct ScriptContext *ctx, void *cmdTable, void *cmdTableEnd)
 {
@@ -68,6 +89,29 @@ void StopScript(struct ScriptContext *ctx)
     ctx->scriptPtr = NULL;
 }
 
+void ResetScriptCmdProfile(void)
+{
+#if PROFILE_SCRIPT_CMDS
+    CpuFill32(0, gScriptCmdProfile, sizeof(gScriptCmdProfile));
+#endif
+}
+
+#if PROFILE_SCRIPT_CMDS
+static bool8 RunProfiledScriptCommand(struct ScriptContext *ctx, u8 cmdCode, ScrCmdFunc func)
+{
+    bool8 result;
+    u32 start;
+
+    ResumeCycleCounter();
+    start = GetCycleCounter();
+
+    result = func(ctx);
+    gScriptCmdProfile[cmdCode].cycles += GetCyclesSince(start);
+    gScriptCmdProfile[cmdCode].count++;
+    return result;
+}
+#endif
+
 bool8 RunScriptCommand(struct ScriptContext *ctx)
 {
     if (ctx->mode == SCRIPT_MODE_STOPPED)
@@ -89,6 +133,21 @@ bool8 RunScriptCommand(struct ScriptContext *ctx)
         ctx->mode = SCRIPT_MODE_BYTECODE;
         // fallthrough
     case SCRIPT_MODE_BYTECODE:
+#if SCRIPT_LOOP_IN_IWRAM && !PROFILE_SCRIPT_CMDS
+        // Every opcode is in the table, so only the script pointer needs checking
+        if (ctx->cmdTableEnd - ctx->cmdTable >= 0x100)
+        {
+            if (!sRunScriptCommandsRAM_Loaded)
+            {
+                CpuCopy32((void *)RunScriptCommands_Arm, sRunScriptCommandsRAM_Buffer, sizeof(sRunScriptCommandsRAM_Buffer));
+                sRunScriptCommandsRAM_Loaded = TRUE;
+            }
+            if (((bool8 (*)(struct ScriptContext *, ScrCmdFunc *))sRunScriptCommandsRAM_Buffer)(ctx, ctx->cmdTable) == TRUE)
+                return TRUE;
+            ctx->mode = SCRIPT_MODE_STOPPED;
+            return FALSE;
+        }
+#endif
         while (1)
         {
             u8 cmdCode;
@@ -100,12 +159,6 @@ bool8 RunScriptCommand(struct ScriptContext *ctx)
                 return FALSE;
             }
 
-            if (ctx->scriptPtr == gNullScriptPtr)
-            {
-                while (1)
-                    asm("svc 2"); // HALT
-            }
-
             cmdCode = *(ctx->scriptPtr);
             ctx->scriptPtr++;
             func = &ctx->cmdTable[cmdCode];
@@ -116,6 +169,14 @@ bool8 RunScriptCommand(struct ScriptContext *ctx)
                 return FALSE;
             }
 
+#if PROFILE_SCRIPT_CMDS
+            if (ctx->cmdTable == gScriptCmdTable)
+            {
+                if (RunProfiledScriptCommand(ctx, cmdCode, *func) == TRUE)
+                    return TRUE;
+                continue;
+            }
+#endif
             if ((*func)(ctx) == TRUE)
                 return TRUE;
         }
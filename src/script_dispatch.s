@@ -0,0 +1,41 @@
+	.include "asm/macros.inc"
+
+	.syntax unified
+
+	.text
+
+@ bool8 RunScriptCommands_Arm(struct ScriptContext *ctx, ScrCmdFunc *cmdTable)
+@ Runs script commands until one returns TRUE, returning TRUE, or the script
+@ pointer is NULL, returning FALSE. cmdTable must have an entry for every u8.
+@ Used by RunScriptCommand in script.c, which copies it to IWRAM, so it must
+@ only use pc-relative branches.
+	arm_func_start RunScriptCommands_Arm
+RunScriptCommands_Arm:
+	push {r4, r5, lr}
+	mov r4, r0
+	mov r5, r1
+RunScriptCommands_Arm_Loop:
+	ldr r1, [r4, 0x8] @ ctx->scriptPtr
+	cmp r1, 0
+	beq RunScriptCommands_Arm_Stopped
+	ldrb r2, [r1], 1
+	str r1, [r4, 0x8]
+	ldr r3, [r5, r2, lsl 2]
+	mov r0, r4
+	mov lr, pc
+	bx r3
+	and r0, r0, 0xFF
+	cmp r0, 1
+	bne RunScriptCommands_Arm_Loop
+	pop {r4, r5, lr}
+	bx lr
+RunScriptCommands_Arm_Stopped:
+	mov r0, 0
+	pop {r4, r5, lr}
+	bx lr
+	arm_func_end RunScriptCommands_Arm
+
+	@ Must fit in sRunScriptCommandsRAM_Buffer in script.c
+	.if . - RunScriptCommands_Arm > 0x60
+	.error "RunScriptCommands_Arm is too large for its IWRAM buffer"
+	.endif
@@ -14,17 +14,16 @@
     (sSpriteTileRanges + 1)[index * 2] = count;    \
 }
 
-#define ALLOC_SPRITE_TILE(n)                             \
-{                                                        \
-    sSpriteTileAllocBitmap[(n) / 8] |= (1 << ((n) % 8)); \
-}
-
-#define FREE_SPRITE_TILE(n)                               \
-{                                                         \
-    sSpriteTileAllocBitmap[(n) / 8] &= ~(1 << ((n) % 8)); \
-}
+// Tile n is bit n % 32 of word n / 32, which on the GBA's little-endian
+// memory is also bit n % 8 of byte n / 8.
+#define NUM_SPRITE_TILE_ALLOC_WORDS (TOTAL_OBJ_TILE_COUNT / 32)
 
-#define SPRITE_TILE_IS_ALLOCATED(n) ((sSpriteTileAllocBitmap[(n) / 8] >> ((n) % 8)) & 1)
+// Open addressing table from tile tags to their index in sSpriteTileRangeTags.
+// Each entry is the index + 1, or one of these.
+#define SPRITE_TILE_TAG_HASH_SIZE 128
+#define SPRITE_TILE_TAG_HASH_EMPTY 0
+#define SPRITE_TILE_TAG_HASH_DELETED 0xFF
+#define SPRITE_TILE_TAG_HASH(tag) ((u16)((tag) * 0x9E37) >> 9)
 
 
 struct SpriteCopyRequest
@@ -90,6 +89,9 @@ static s16 ConvertScaleParam(s16 scale);
 static void GetAffineAnimFrame(u8 matrixNum, struct Sprite *sprite, struct AffineAnimFrameCmd *frameCmd);
 static void ApplyAffineAnimFrame(u8 matrixNum, struct AffineAnimFrameCmd *frameCmd);
 static u8 IndexOfSpriteTileTag(u16 tag);
+static void SetSpriteTileRangeAllocated(u16 start, u16 count, bool32 allocated);
+static void AddSpriteTileTagToHash(u16 tag, u8 index);
+static void RemoveSpriteTileTagFromHash(u16 tag, u8 index);
 static void AllocSpriteTileRange(u16 tag, u16 start, u16 count);
 static void DoLoadSpritePalette(const u16 *src, u16 paletteOffset);
 static void UpdateSpriteMatrixAnchorPos(struct Sprite *, s32, s32);
@@ -285,12 +287,26 @@ EWRAM_DATA static u8 sSpriteCopyRequestCount = 0;
 EWRAM_DATA static struct SpriteCopyRequest sSpriteCopyRequests[MAX_SPRITES] = {0};
 EWRAM_DATA u8 gOamLimit = 0;
 EWRAM_DATA u16 gReservedSpriteTileCount = 0;
-EWRAM_DATA static u8 sSpriteTileAllocBitmap[128] = {0};
+EWRAM_DATA static u32 sSpriteTileAllocBitmap[NUM_SPRITE_TILE_ALLOC_WORDS] = {0};
+EWRAM_DATA static u8 ALIGNED(4) sSpriteTileTagHash[SPRITE_TILE_TAG_HASH_SIZE] = {0};
 EWRAM_DATA s16 gSpriteCoordOffsetX = 0;
 EWRAM_DATA s16 gSpriteCoordOffsetY = 0;
 EWRAM_DATA struct OamMatrix gOamMatrices[OAM_MATRIX_COUNT] = {0};
 EWRAM_DATA bool8 gAffineAnimsDisabled = FALSE;
 
+// The last matrix each affine anim state was turned into, and the scale and rotation it
+// came from. Sprites whose affine anim has ended or is on a frame that doesn't change
+// anything still update their matrix every frame, so this saves recalculating it.
+struct AffineAnimMatrixCache
+{
+    s16 xScale;
+    s16 yScale;
+    u16 rotation;
+    bool16 valid;
+    struct OamMatrix matrix;
+};
+EWRAM_DATA static struct AffineAnimMatrixCache sAffineAnimMatrixCache[OAM_MATRIX_COUNT] = {0};
+
 void ResetSpriteData(void)
 {
     ResetOamRange(0, 128);
@@ -308,6 +324,10 @@ void ResetSpriteData(void)
 void AnimateSprites(void)
 {
     u8 i;
+#ifdef FRAME_PROFILE
+    u32 profileStart = GetCycleCounter();
+#endif
+
     for (i = 0; i < MAX_SPRITES; i++)
     {
         struct Sprite *sprite = &gSprites[i];
@@ -320,11 +340,18 @@ void AnimateSprites(void)
                 AnimateSprite(sprite);
         }
     }
+#ifdef FRAME_PROFILE
+    FrameProfile_AddCycles(FRAME_PROFILE_ANIMATE_SPRITES, profileStart);
+#endif
 }
 
 void BuildOamBuffer(void)
 {
     u8 temp;
+#ifdef FRAME_PROFILE
+    u32 profileStart = GetCycleCounter();
+#endif
+
     UpdateOamCoords();
     BuildSpritePriorities();
     SortSprites();
@@ -334,6 +361,9 @@ void BuildOamBuffer(void)
     CopyMatricesToOamBuffer();
     gMain.oamLoadDisabled = temp;
     sShouldProcessSpriteCopyRequests = TRUE;
+#ifdef FRAME_PROFILE
+    FrameProfile_AddCycles(FRAME_PROFILE_BUILD_OAM, profileStart);
+#endif
 }
 
 void UpdateOamCoords(void)
@@ -620,12 +650,7 @@ void DestroySprite(struct Sprite *sprite)
     if (sprite->inUse)
     {
         if (!sprite->usingSheet)
-        {
-            u16 i;
-            u16 tileEnd = (sprite->images->size / TILE_SIZE_4BPP) + sprite->oam.tileNum;
-            for (i = sprite->oam.tileNum; i < tileEnd; i++)
-                FREE_SPRITE_TILE(i);
-        }
+            SetSpriteTileRangeAllocated(sprite->oam.tileNum, sprite->images->size / TILE_SIZE_4BPP, FALSE);
         ResetSprite(sprite);
     }
 }
@@ -699,61 +724,133 @@ void CalcCenterToCornerVec(struct Sprite *sprite, u8 shape, u8 size, u8 affineMo
     sprite->centerToCornerVecY = y;
 }
 
+static void SetSpriteTileRangeAllocated(u16 start, u16 count, bool32 allocated)
+{
+    u32 i = start / 32;
+    u32 shift = start % 32;
+    u32 mask;
+
+    if (start >= TOTAL_OBJ_TILE_COUNT)
+        return;
+    if (count > TOTAL_OBJ_TILE_COUNT - start)
+        count = TOTAL_OBJ_TILE_COUNT - start;
+
+    while (count != 0)
+    {
+        if (shift == 0 && count >= 32)
+        {
+            mask = 0xFFFFFFFF;
+            count -= 32;
+        }
+        else
+        {
+            u32 numBits = 32 - shift;
+            if (numBits > count)
+                numBits = count;
+            mask = (0xFFFFFFFF >> (32 - numBits)) << shift;
+            count -= numBits;
+        }
+
+        if (allocated)
+            sSpriteTileAllocBitmap[i] |= mask;
+        else
+            sSpriteTileAllocBitmap[i] &= ~mask;
+        i++;
+        shift = 0;
+    }
+}
+
+// The ARM7TDMI has no count leading/trailing zeros instruction, so the lowest
+// set bit is isolated and looked up with a de Bruijn sequence instead.
+static const u8 sDeBruijnBitPositions[32] =
+{
+     0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+    31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9,
+};
+
+#define LOWEST_SET_BIT(x) (sDeBruijnBitPositions[((u32)(((x) & -(x)) * 0x077CB531)) >> 27])
+
+// Returns the first tile from start onwards that is allocated, or free if
+// allocated is FALSE, or TOTAL_OBJ_TILE_COUNT if there isn't one.
+static u16 FindNextSpriteTile(u16 start, bool32 allocated)
+{
+    u32 i = start / 32;
+    u32 invert = allocated ? 0 : 0xFFFFFFFF;
+    u32 word;
+
+    if (start >= TOTAL_OBJ_TILE_COUNT)
+        return TOTAL_OBJ_TILE_COUNT;
+
+    word = (sSpriteTileAllocBitmap[i] ^ invert) & (0xFFFFFFFF << (start % 32));
+    while (word == 0)
+    {
+        if (++i == NUM_SPRITE_TILE_ALLOC_WORDS)
+            return TOTAL_OBJ_TILE_COUNT;
+        word = sSpriteTileAllocBitmap[i] ^ invert;
+    }
+    return i * 32 + LOWEST_SET_BIT(word);
+}
+
 s16 AllocSpriteTiles(u16 tileCount)
 {
-    u16 i;
-    s16 start;
-    u16 numTilesFound;
+    u16 start, end;
 
     if (tileCount == 0)
     {
         // Free all unreserved tiles if the tile count is 0.
-        for (i = gReservedSpriteTileCount; i < TOTAL_OBJ_TILE_COUNT; i++)
-            FREE_SPRITE_TILE(i);
-
+        SetSpriteTileRangeAllocated(gReservedSpriteTileCount, TOTAL_OBJ_TILE_COUNT - gReservedSpriteTileCount, FALSE);
         return 0;
     }
 
-    i = gReservedSpriteTileCount;
-
+    // Use the first run of free tiles that's long enough, skipping a word at a time
+    end = gReservedSpriteTileCount;
     for (;;)
     {
-        while (SPRITE_TILE_IS_ALLOCATED(i))
-        {
-            i++;
-
-            if (i == TOTAL_OBJ_TILE_COUNT)
-                return -1;
-        }
+        start = FindNextSpriteTile(end, FALSE);
+        if (start + tileCount > TOTAL_OBJ_TILE_COUNT)
+            return -1;
 
-        start = i;
-        numTilesFound = 1;
+        end = FindNextSpriteTile(start, TRUE);
+        if (end - start >= tileCount)
+            break;
+    }
 
-        while (numTilesFound != tileCount)
-        {
-            i++;
+    SetSpriteTileRangeAllocated(start, tileCount, TRUE);
+    return start;
+}
 
-            if (i == TOTAL_OBJ_TILE_COUNT)
-                return -1;
+void GetSpriteTileAllocStats(struct SpriteTileAllocStats *stats)
+{
+    u16 start, end;
 
-            if (!SPRITE_TILE_IS_ALLOCATED(i))
-                numTilesFound++;
-            else
-                break;
-        }
+    stats->freeTiles = 0;
+    stats->largestFreeRun = 0;
+    stats->numFreeRuns = 0;
 
-        if (numTilesFound == tileCount)
+    end = gReservedSpriteTileCount;
+    while (end < TOTAL_OBJ_TILE_COUNT)
+    {
+        start = FindNextSpriteTile(end, FALSE);
+        if (start == TOTAL_OBJ_TILE_COUNT)
             break;
-    }
 
-    for (i = start; i < tileCount + start; i++)
-        ALLOC_SPRITE_TILE(i);
+        end = FindNextSpriteTile(start, TRUE);
+        stats->freeTiles += end - start;
+        stats->numFreeRuns++;
+        if (end - start > stats->largestFreeRun)
+            stats->largestFreeRun = end - start;
+    }
 
-    return start;
+    // The percentage of free tiles that can't be used by the largest allocation that would fit
+    if (stats->freeTiles != 0)
+        stats->fragmentation = 100 - (stats->largestFreeRun * 100) / stats->freeTiles;
+    else
+        stats->fragmentation = 0;
 }
 
 u8 SpriteTileAllocBitmapOp(u16 bit, u8 op)
 {
+    u8 *bitmap = (u8 *)sSpriteTileAllocBitmap;
     u8 index = bit / 8;
     u8 shift = bit % 8;
     u8 val = bit % 8;
@@ -762,17 +859,17 @@ u8 SpriteTileAllocBitmapOp(u16 bit, u8 op)
     if (op == 0)
     {
         val = ~(1 << val);
-        sSpriteTileAllocBitmap[index] &= val;
+        bitmap[index] &= val;
     }
     else if (op == 1)
     {
         val = (1 << val);
-        sSpriteTileAllocBitmap[index] |= val;
+        bitmap[index] |= val;
     }
     else
     {
         retVal = 1 << shift;
-        retVal &= sSpriteTileAllocBitmap[index];
+        retVal &= bitmap[index];
     }
 
     return retVal;
@@ -902,7 +999,8 @@ void AnimateSprite(struct Sprite *sprite)
 {
     sAnimFuncs[sprite->animBeginning](sprite);
 
-    if (!gAffineAnimsDisabled)
+    // The affine anim functions don't do anything for sprites that aren't affine
+    if (!gAffineAnimsDisabled && (sprite->oam.affineMode & ST_OAM_AFFINE_ON_MASK))
         sAffineAnimFuncs[sprite->affineAnimBeginning](sprite);
 }
 
@@ -944,13 +1042,12 @@ void ContinueAnim(struct Sprite *sprite)
 {
     if (sprite->animDelayCounter)
     {
-        u8 hFlip;
-        u8 vFlip;
         DecrementAnimDelayCounter(sprite);
-        hFlip = sprite->anims[sprite->animNum][sprite->animCmdIndex].frame.hFlip;
-        vFlip = sprite->anims[sprite->animNum][sprite->animCmdIndex].frame.vFlip;
         if (!(sprite->oam.affineMode & ST_OAM_AFFINE_ON_MASK))
-            SetSpriteOamFlipBits(sprite, hFlip, vFlip);
+        {
+            const struct AnimFrameCmd *frame = &sprite->anims[sprite->animNum][sprite->animCmdIndex].frame;
+            SetSpriteOamFlipBits(sprite, frame->hFlip, frame->vFlip);
+        }
     }
     else if (!sprite->animPaused)
     {
@@ -1302,15 +1399,26 @@ bool8 DecrementAffineAnimDelayCounter(struct Sprite *sprite, u8 matrixNum)
 void ApplyAffineAnimFrameRelativeAndUpdateMatrix(u8 matrixNum, struct AffineAnimFrameCmd *frameCmd)
 {
     struct ObjAffineSrcData srcData;
-    struct OamMatrix matrix;
+    struct AffineAnimMatrixCache *cache = &sAffineAnimMatrixCache[matrixNum];
     sAffineAnimStates[matrixNum].xScale += frameCmd->xScale;
     sAffineAnimStates[matrixNum].yScale += frameCmd->yScale;
     sAffineAnimStates[matrixNum].rotation = (sAffineAnimStates[matrixNum].rotation + (frameCmd->rotation << 8)) & ~0xFF;
-    srcData.xScale = ConvertScaleParam(sAffineAnimStates[matrixNum].xScale);
-    srcData.yScale = ConvertScaleParam(sAffineAnimStates[matrixNum].yScale);
-    srcData.rotation = sAffineAnimStates[matrixNum].rotation;
-    ObjAffineSet(&srcData, &matrix, 1, 2);
-    CopyOamMatrix(matrixNum, &matrix);
+
+    if (!cache->valid
+        || cache->xScale != sAffineAnimStates[matrixNum].xScale
+        || cache->yScale != sAffineAnimStates[matrixNum].yScale
+        || cache->rotation != sAffineAnimStates[matrixNum].rotation)
+    {
+        srcData.xScale = ConvertScaleParam(sAffineAnimStates[matrixNum].xScale);
+        srcData.yScale = ConvertScaleParam(sAffineAnimStates[matrixNum].yScale);
+        srcData.rotation = sAffineAnimStates[matrixNum].rotation;
+        ObjAffineSet(&srcData, &cache->matrix, 1, 2);
+        cache->xScale = sAffineAnimStates[matrixNum].xScale;
+        cache->yScale = sAffineAnimStates[matrixNum].yScale;
+        cache->rotation = sAffineAnimStates[matrixNum].rotation;
+        cache->valid = TRUE;
+    }
+    CopyOamMatrix(matrixNum, &cache->matrix);
 }
 
 s16 ConvertScaleParam(s16 scale)
@@ -1511,20 +1619,9 @@ void FreeSpriteTilesByTag(u16 tag)
     u8 index = IndexOfSpriteTileTag(tag);
     if (index != 0xFF)
     {
-        u16 i;
-        u16 *rangeStarts;
-        u16 *rangeCounts;
-        u16 start;
-        u16 count;
-        rangeStarts = sSpriteTileRanges;
-        start = rangeStarts[index * 2];
-        rangeCounts = sSpriteTileRanges + 1;
-        count = rangeCounts[index * 2];
-
-        for (i = start; i < start + count; i++)
-            FREE_SPRITE_TILE(i);
-
+        SetSpriteTileRangeAllocated(sSpriteTileRanges[index * 2], sSpriteTileRanges[index * 2 + 1], FALSE);
         sSpriteTileRangeTags[index] = TAG_NONE;
+        RemoveSpriteTileTagFromHash(tag, index);
     }
 }
 
@@ -1537,6 +1634,7 @@ void FreeSpriteTileRanges(void)
         sSpriteTileRangeTags[i] = TAG_NONE;
         SET_SPRITE_TILE_RANGE(i, 0, 0);
     }
+    CpuFill32(0, sSpriteTileTagHash, sizeof(sSpriteTileTagHash));
 }
 
 u16 GetSpriteTileStartByTag(u16 tag)
@@ -1547,17 +1645,96 @@ u16 GetSpriteTileStartByTag(u16 tag)
     return sSpriteTileRanges[index * 2];
 }
 
+// Returns the lowest index in sSpriteTileRangeTags holding the tag, or 0xFF
 u8 IndexOfSpriteTileTag(u16 tag)
 {
     u8 i;
+    u8 entry;
+    u8 hash;
 
-    for (i = 0; i < MAX_SPRITES; i++)
-        if (sSpriteTileRangeTags[i] == tag)
-            return i;
+    if (tag == TAG_NONE)
+    {
+        for (i = 0; i < MAX_SPRITES; i++)
+            if (sSpriteTileRangeTags[i] == TAG_NONE)
+                return i;
+
+        return 0xFF;
+    }
+
+    hash = SPRITE_TILE_TAG_HASH(tag);
+    for (i = 0; i < SPRITE_TILE_TAG_HASH_SIZE; i++)
+    {
+        entry = sSpriteTileTagHash[hash];
+        if (entry == SPRITE_TILE_TAG_HASH_EMPTY)
+            break;
+        if (entry != SPRITE_TILE_TAG_HASH_DELETED && sSpriteTileRangeTags[entry - 1] == tag)
+            return entry - 1;
+        hash = (hash + 1) % SPRITE_TILE_TAG_HASH_SIZE;
+    }
 
     return 0xFF;
 }
 
+// Only the lowest index holding a tag is in the hash table. If the same tag is
+// loaded more than once, the others are found by a linear search when it's freed.
+static void AddSpriteTileTagToHash(u16 tag, u8 index)
+{
+    u8 i;
+    u8 entry;
+    u8 hash = SPRITE_TILE_TAG_HASH(tag);
+    u8 freeHash = 0xFF;
+
+    for (i = 0; i < SPRITE_TILE_TAG_HASH_SIZE; i++)
+    {
+        entry = sSpriteTileTagHash[hash];
+        if (entry == SPRITE_TILE_TAG_HASH_EMPTY || entry == SPRITE_TILE_TAG_HASH_DELETED)
+        {
+            if (freeHash == 0xFF)
+                freeHash = hash;
+            if (entry == SPRITE_TILE_TAG_HASH_EMPTY)
+                break;
+        }
+        else if (sSpriteTileRangeTags[entry - 1] == tag)
+        {
+            if (index < entry - 1)
+                sSpriteTileTagHash[hash] = index + 1;
+            return;
+        }
+        hash = (hash + 1) % SPRITE_TILE_TAG_HASH_SIZE;
+    }
+
+    // There are always fewer tags than entries, so there is a free entry
+    sSpriteTileTagHash[freeHash] = index + 1;
+}
+
+static void RemoveSpriteTileTagFromHash(u16 tag, u8 index)
+{
+    u8 i;
+    u8 hash = SPRITE_TILE_TAG_HASH(tag);
+
+    for (i = 0; i < SPRITE_TILE_TAG_HASH_SIZE; i++)
+    {
+        if (sSpriteTileTagHash[hash] == SPRITE_TILE_TAG_HASH_EMPTY)
+            return;
+        if (sSpriteTileTagHash[hash] == index + 1)
+            break;
+        hash = (hash + 1) % SPRITE_TILE_TAG_HASH_SIZE;
+    }
+    if (i == SPRITE_TILE_TAG_HASH_SIZE)
+        return;
+
+    // Point the entry at another copy of the tag if there is one
+    for (i = index + 1; i < MAX_SPRITES; i++)
+    {
+        if (sSpriteTileRangeTags[i] == tag)
+        {
+            sSpriteTileTagHash[hash] = i + 1;
+            return;
+        }
+    }
+    sSpriteTileTagHash[hash] = SPRITE_TILE_TAG_HASH_DELETED;
+}
+
 u16 GetSpriteTileTagByTileStart(u16 start)
 {
     u8 i;
@@ -1576,6 +1753,8 @@ void AllocSpriteTileRange(u16 tag, u16 start, u16 count)
     u8 freeIndex = IndexOfSpriteTileTag(TAG_NONE);
     sSpriteTileRangeTags[freeIndex] = tag;
     SET_SPRITE_TILE_RANGE(freeIndex, start, count);
+    if (freeIndex < MAX_SPRITES)
+        AddSpriteTileTagToHash(tag, freeIndex);
 }
 
 void FreeAllSpritePalettes(void)
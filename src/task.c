@@ -1,5 +1,6 @@
 #include "global.h"
 #include "task.h"
+#include "main.h"
 
 COMMON_DATA struct Task gTasks[NUM_TASKS] = {0};
 
@@ -110,15 +111,29 @@ void DestroyTask(u8 taskId)
 void RunTasks(void)
 {
     u8 taskId = FindFirstActiveTask();
+#ifdef FRAME_PROFILE
+    u32 profileStart = GetCycleCounter();
+#endif
 
     if (taskId != NUM_TASKS)
     {
         do
         {
+#ifdef FRAME_PROFILE
+            TaskFunc func = gTasks[taskId].func;
+            u32 taskStart = GetCycleCounter();
+
+            func(taskId);
+            FrameProfile_AddTaskCycles(func, taskStart);
+#else
             gTasks[taskId].func(taskId);
+#endif
             taskId = gTasks[taskId].next;
         } while (taskId != TAIL_SENTINEL);
     }
+#ifdef FRAME_PROFILE
+    FrameProfile_AddCycles(FRAME_PROFILE_TASKS, profileStart);
+#endif
 }
 
 static u8 FindFirstActiveTask(void)
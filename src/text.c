@@ -29,6 +29,8 @@ static void DecompressGlyph_Short(u16, bool32);
 static void DecompressGlyph_Narrow(u16, bool32);
 static void DecompressGlyph_SmallNarrow(u16, bool32);
 static void DecompressGlyph_Bold(u16);
+static void DecompressGlyph(u8, u16, bool32);
+static void ClearGlyphCache(void);
 static u32 GetGlyphWidth_Small(u16, bool32);
 static u32 GetGlyphWidth_Normal(u16, bool32);
 static u32 GetGlyphWidth_Short(u16, bool32);
@@ -43,6 +45,25 @@ static u16 sLastTextBgColor;
 static u16 sLastTextFgColor;
 static u16 sLastTextShadowColor;
 
+// Recently decompressed glyphs, so that repeated characters don't have to be
+// expanded through sFontHalfRowLookupTable again. The keys are kept apart from
+// the glyph data so that the lookup only has to scan a few words of IWRAM.
+#define GLYPH_CACHE_SIZE 16
+#define GLYPH_CACHE_IN_USE (1u << 31)
+#define GLYPH_CACHE_KEY(fontId, glyphId, isJapanese) \
+    (GLYPH_CACHE_IN_USE                              \
+   | ((glyphId) & 0x1FF)                             \
+   | ((isJapanese) ? (1 << 9) : 0)                   \
+   | (((fontId) & 0xF) << 10)                        \
+   | ((sLastTextFgColor & 0xF) << 16)                \
+   | ((sLastTextBgColor & 0xF) << 20)                \
+   | ((sLastTextShadowColor & 0xF) << 24))
+
+static u32 sGlyphCacheKeys[GLYPH_CACHE_SIZE];
+static u16 sGlyphCacheLastUsed[GLYPH_CACHE_SIZE];
+static u16 sGlyphCacheClock;
+static EWRAM_DATA struct TextGlyph sGlyphCache[GLYPH_CACHE_SIZE] = {0};
+
 COMMON_DATA const struct FontInfo *gFonts = NULL;
 COMMON_DATA bool8 gDisableTextPrinters = 0;
 COMMON_DATA struct TextGlyph gCurGlyph = {0};
@@ -1120,30 +1141,7 @@ static u16 RenderText(struct TextPrinter *textPrinter)
             return RENDER_FINISH;
         }
 
-        switch (subStruct->fontId)
-        {
-        case FONT_SMALL:
-            DecompressGlyph_Small(currChar, textPrinter->japanese);
-            break;
-        case FONT_NORMAL:
-            DecompressGlyph_Normal(currChar, textPrinter->japanese);
-            break;
-        case FONT_SHORT:
-        case FONT_SHORT_COPY_1:
-        case FONT_SHORT_COPY_2:
-        case FONT_SHORT_COPY_3:
-            DecompressGlyph_Short(currChar, textPrinter->japanese);
-            break;
-        case FONT_NARROW:
-            DecompressGlyph_Narrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_SMALL_NARROW:
-            DecompressGlyph_SmallNarrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_BRAILLE:
-            break;
-        }
-
+        DecompressGlyph(subStruct->fontId, currChar, textPrinter->japanese);
         CopyGlyphToWindow(textPrinter);
 
         if (textPrinter->minLetterSpacing)
@@ -1902,3 +1900,86 @@ static void DecompressGlyph_Bold(u16 glyphId)
     gCurGlyph.width = 8;
     gCurGlyph.height = 12;
 }
+
+static void ClearGlyphCache(void)
+{
+    u32 i;
+
+    for (i = 0; i < GLYPH_CACHE_SIZE; i++)
+    {
+        sGlyphCacheKeys[i] = 0;
+        sGlyphCacheLastUsed[i] = 0;
+    }
+    sGlyphCacheClock = 0;
+}
+
+// Decompresses a glyph into gCurGlyph using the current text colors, reusing
+// the result of an earlier call if the same glyph was drawn recently.
+static void DecompressGlyph(u8 fontId, u16 glyphId, bool32 isJapanese)
+{
+    u32 key, i, slot;
+
+    switch (fontId)
+    {
+    case FONT_SHORT_COPY_1:
+    case FONT_SHORT_COPY_2:
+    case FONT_SHORT_COPY_3:
+        fontId = FONT_SHORT;
+        break;
+    case FONT_SMALL:
+    case FONT_NORMAL:
+    case FONT_SHORT:
+    case FONT_NARROW:
+    case FONT_SMALL_NARROW:
+        break;
+    default:
+        return;
+    }
+
+    // The decompressors only treat isJapanese == TRUE as Japanese.
+    key = GLYPH_CACHE_KEY(fontId, glyphId, isJapanese == TRUE);
+
+    if (++sGlyphCacheClock == 0)
+    {
+        // Rather than renormalizing the timestamps, just start over.
+        ClearGlyphCache();
+        sGlyphCacheClock = 1;
+    }
+
+    slot = 0;
+    for (i = 0; i < GLYPH_CACHE_SIZE; i++)
+    {
+        if (sGlyphCacheKeys[i] == key)
+        {
+            sGlyphCacheLastUsed[i] = sGlyphCacheClock;
+            gCurGlyph = sGlyphCache[i];
+            return;
+        }
+        if (sGlyphCacheLastUsed[i] < sGlyphCacheLastUsed[slot])
+            slot = i;
+    }
+
+    switch (fontId)
+    {
+    case FONT_SMALL:
+        DecompressGlyph_Small(glyphId, isJapanese);
+        break;
+    case FONT_NORMAL:
+        DecompressGlyph_Normal(glyphId, isJapanese);
+        break;
+    case FONT_SHORT:
+        DecompressGlyph_Short(glyphId, isJapanese);
+        break;
+    case FONT_NARROW:
+        DecompressGlyph_Narrow(glyphId, isJapanese);
+        break;
+    case FONT_SMALL_NARROW:
+        DecompressGlyph_SmallNarrow(glyphId, isJapanese);
+        break;
+    }
+
+    // Evict the least recently used glyph. Empty slots have never been used, so they go first.
+    sGlyphCacheKeys[slot] = key;
+    sGlyphCacheLastUsed[slot] = sGlyphCacheClock;
+    sGlyphCache[slot] = gCurGlyph;
+}
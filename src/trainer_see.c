@@ -3,6 +3,7 @@
 #include "event_data.h"
 #include "event_object_movement.h"
 #include "field_effect.h"
+#include "fieldmap.h"
 #include "field_player_avatar.h"
 #include "pokemon.h"
 #include "script.h"
@@ -20,6 +21,7 @@
 #include "constants/trainer_types.h"
 
 // this file's functions
+static bool8 IsPlayerInTrainerSight(void);
 static u8 CheckTrainer(u8 objectEventId);
 static u8 GetTrainerApproachDistance(struct ObjectEvent *trainerObj);
 static u8 CheckPathBetweenTrainerAndPlayer(struct ObjectEvent *trainerObj, u8 approachDistance, u8 direction);
@@ -55,9 +57,29 @@ COMMON_DATA struct ApproachingTrainer gApproachingTrainers[2] = {0};
 COMMON_DATA u8 gNoOfApproachingTrainers = 0;
 COMMON_DATA bool8 gTrainerApproachedPlayer = 0;
 
+// What a trainer object's sight line depended on when sTrainerSightMap was built
+struct TrainerSight
+{
+    s16 x;
+    s16 y;
+    u8 trainerType;
+    u8 facingDirection;
+    u8 range;
+};
+
 // EWRAM
 EWRAM_DATA u8 gApproachingTrainerId = 0;
 
+// A bit for every tile of the current map that's in the sight line of a trainer object,
+// ignoring anything that could block it and whether the trainer was already defeated.
+// On any other tile no trainer can see the player, so most steps don't need to check
+// every trainer.
+EWRAM_DATA static u32 sTrainerSightMap[MAX_MAP_DATA_SIZE / 32] = {0};
+EWRAM_DATA static struct TrainerSight sTrainerSights[OBJECT_EVENTS_COUNT] = {0};
+EWRAM_DATA static s32 sTrainerSightMapWidth = 0;
+EWRAM_DATA static s32 sTrainerSightMapHeight = 0;
+EWRAM_DATA static bool8 sTrainerSightMapIncomplete = FALSE;
+
 // const rom data
 static const u8 sEmotion_ExclamationMarkGfx[] = INCBIN_U8("graphics/field_effects/pics/emotion_exclamation.4bpp");
 static const u8 sEmotion_QuestionMarkGfx[] = INCBIN_U8("graphics/field_effects/pics/emotion_question.4bpp");
@@ -195,6 +217,12 @@ bool8 CheckForTrainersWantingBattle(void)
     gNoOfApproachingTrainers = 0;
     gApproachingTrainerId = 0;
 
+    if (!IsPlayerInTrainerSight())
+    {
+        gTrainerApproachedPlayer = FALSE;
+        return FALSE;
+    }
+
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
     {
         u8 numTrainers;
@@ -245,6 +273,127 @@ bool8 CheckForTrainersWantingBattle(void)
     }
 }
 
+static void MarkTrainerSightLine(s16 x, s16 y, u8 direction, u8 range)
+{
+    u8 i;
+    s32 tile;
+
+    for (i = 0; i < range; i++)
+    {
+        MoveCoords(direction, &x, &y);
+        if (x < 0 || y < 0 || x >= sTrainerSightMapWidth || y >= sTrainerSightMapHeight)
+            break;
+
+        tile = y * sTrainerSightMapWidth + x;
+        sTrainerSightMap[tile / 32] |= 1u << (tile % 32);
+    }
+}
+
+static void BuildTrainerSightMap(void)
+{
+    u8 i, direction;
+    struct TrainerSight *sight;
+
+    sTrainerSightMapIncomplete = FALSE;
+    if (sTrainerSightMapWidth * sTrainerSightMapHeight > MAX_MAP_DATA_SIZE)
+    {
+        sTrainerSightMapIncomplete = TRUE;
+        return;
+    }
+
+    CpuFill32(0, sTrainerSightMap, sizeof(sTrainerSightMap));
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    {
+        sight = &sTrainerSights[i];
+        if (sight->trainerType == TRAINER_TYPE_NONE)
+            continue;
+
+        if (sight->trainerType != TRAINER_TYPE_NORMAL)
+        {
+            for (direction = DIR_SOUTH; direction <= DIR_EAST; direction++)
+                MarkTrainerSightLine(sight->x, sight->y, direction, sight->range);
+        }
+        else if (sight->facingDirection >= DIR_SOUTH && sight->facingDirection <= DIR_EAST)
+        {
+            MarkTrainerSightLine(sight->x, sight->y, sight->facingDirection, sight->range);
+        }
+        else
+        {
+            // Only the four cardinal directions have a sight line, so leave any other
+            // facing direction to GetTrainerApproachDistance.
+            sTrainerSightMapIncomplete = TRUE;
+        }
+    }
+}
+
+// Rebuilds sTrainerSightMap if the map or any trainer object changed since it was built.
+static void UpdateTrainerSightMap(void)
+{
+    u8 i;
+    bool8 changed = FALSE;
+
+    if (sTrainerSightMapWidth != gBackupMapLayout.width || sTrainerSightMapHeight != gBackupMapLayout.height)
+    {
+        sTrainerSightMapWidth = gBackupMapLayout.width;
+        sTrainerSightMapHeight = gBackupMapLayout.height;
+        changed = TRUE;
+    }
+
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    {
+        struct ObjectEvent *objectEvent = &gObjectEvents[i];
+        struct TrainerSight *sight = &sTrainerSights[i];
+        s16 x = 0, y = 0;
+        u8 trainerType = TRAINER_TYPE_NONE;
+        u8 facingDirection = DIR_NONE;
+        u8 range = 0;
+
+        // Same as the objects checked by CheckForTrainersWantingBattle
+        if (objectEvent->active
+         && (objectEvent->trainerType == TRAINER_TYPE_NORMAL || objectEvent->trainerType == TRAINER_TYPE_BURIED))
+        {
+            x = objectEvent->currentCoords.x;
+            y = objectEvent->currentCoords.y;
+            trainerType = objectEvent->trainerType;
+            if (trainerType == TRAINER_TYPE_NORMAL)
+                facingDirection = objectEvent->facingDirection;
+            range = objectEvent->trainerRange_berryTreeId;
+        }
+
+        if (sight->x != x || sight->y != y || sight->trainerType != trainerType
+         || sight->facingDirection != facingDirection || sight->range != range)
+        {
+            sight->x = x;
+            sight->y = y;
+            sight->trainerType = trainerType;
+            sight->facingDirection = facingDirection;
+            sight->range = range;
+            changed = TRUE;
+        }
+    }
+
+    if (changed)
+        BuildTrainerSightMap();
+}
+
+// Returns FALSE if no trainer could possibly see the player's destination.
+static bool8 IsPlayerInTrainerSight(void)
+{
+    s16 x, y;
+    s32 tile;
+
+    UpdateTrainerSightMap();
+    if (sTrainerSightMapIncomplete)
+        return TRUE;
+
+    PlayerGetDestCoords(&x, &y);
+    if (x < 0 || y < 0 || x >= sTrainerSightMapWidth || y >= sTrainerSightMapHeight)
+        return TRUE;
+
+    tile = y * sTrainerSightMapWidth + x;
+    return (sTrainerSightMap[tile / 32] >> (tile % 32)) & 1;
+}
+
 static u8 CheckTrainer(u8 objectEventId)
 {
     const u8 *scriptPtr;
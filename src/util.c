@@ -261,19 +261,103 @@ u32 CalcByteArraySum(const u8 *data, u32 length)
     return sum;
 }
 
-void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u16 blendColor)
+// BlendColors works on two packed colors per word. Each mask picks three 5-bit channels
+// out of a pair with at least 4 clear bits above each one, so they can all be multiplied
+// by a coefficient of up to 16 at once without carrying into each other.
+#define BLEND_MASK_A 0x03E07C1F // red and blue of the first color, green of the second
+#define BLEND_MASK_B 0x03E0F81F // green of the first color, red and blue of the second (after >> 5)
+
+// c + ((t - c) * coeff) / 16, rounded down, is the same as (c * (16 - coeff) + t * coeff) / 16,
+// which has no negative terms. blendA and blendB are the target colors' channels times coeff.
+static inline u32 BlendColorPair(u32 color, u32 blendA, u32 blendB, u32 invCoeff)
+{
+    u32 a = ((color & BLEND_MASK_A) * invCoeff + blendA) >> 4;
+    u32 b = (((color >> 5) & BLEND_MASK_B) * invCoeff + blendB) >> 4;
+    return (a & BLEND_MASK_A) | ((b & BLEND_MASK_B) << 5);
+}
+
+// When this is TRUE BlendColors uses an ARM routine copied to IWRAM,
+// otherwise it uses the equivalent Thumb loop in ROM.
+#define BLEND_IN_IWRAM TRUE
+
+#if BLEND_IN_IWRAM
+void BlendColorPairs_Arm(const u32 *src, u32 *dest, u32 numPairs, u32 coeff, u32 blendColor);
+
+static u32 sBlendColorPairsRAM_Buffer[0x20];
+static bool8 sBlendColorPairsRAM_Loaded;
+#endif
+
+static void BlendColorPairs(const u32 *src, u32 *dest, u32 numPairs, u32 coeff, u32 blendColor)
+{
+#if BLEND_IN_IWRAM
+    if (!sBlendColorPairsRAM_Loaded)
+    {
+        CpuCopy32((void *)BlendColorPairs_Arm, sBlendColorPairsRAM_Buffer, sizeof(sBlendColorPairsRAM_Buffer));
+        sBlendColorPairsRAM_Loaded = TRUE;
+    }
+    ((void (*)(const u32 *, u32 *, u32, u32, u32))sBlendColorPairsRAM_Buffer)(src, dest, numPairs, coeff, blendColor);
+#else
+    u32 blendA, blendB;
+
+    blendColor |= blendColor << 16;
+    blendA = (blendColor & BLEND_MASK_A) * coeff;
+    blendB = ((blendColor >> 5) & BLEND_MASK_B) * coeff;
+    coeff = 16 - coeff;
+
+    for (; numPairs != 0; numPairs--)
+    {
+        *dest = BlendColorPair(*src, blendA, blendB, coeff);
+        src++;
+        dest++;
+    }
+#endif
+}
+
+// Blends numColors colors from src towards blendColor by coeff / 16 and writes them to dest.
+// src and dest may be the same.
+void BlendColors(const u16 *src, u16 *dest, u16 numColors, u8 coeff, u16 blendColor)
 {
     u16 i;
-    for (i = 0; i < numEntries; i++)
+    u32 blendA, blendB;
+
+    if (coeff > 16 || (((u32)src ^ (u32)dest) & 2))
     {
-        u16 index = i + palOffset;
-        struct PlttData *data1 = (struct PlttData *)&gPlttBufferUnfaded[index];
-        s8 r = data1->r;
-        s8 g = data1->g;
-        s8 b = data1->b;
+        // The packed blend can't handle these, so blend one channel at a time.
         struct PlttData *data2 = (struct PlttData *)&blendColor;
-        gPlttBufferFaded[index] = RGB(r + (((data2->r - r) * coeff) >> 4),
-                                      g + (((data2->g - g) * coeff) >> 4),
-                                      b + (((data2->b - b) * coeff) >> 4));
+        for (i = 0; i < numColors; i++)
+        {
+            struct PlttData *data1 = (struct PlttData *)&src[i];
+            s8 r = data1->r;
+            s8 g = data1->g;
+            s8 b = data1->b;
+            dest[i] = RGB(r + (((data2->r - r) * coeff) >> 4),
+                          g + (((data2->g - g) * coeff) >> 4),
+                          b + (((data2->b - b) * coeff) >> 4));
+        }
+        return;
+    }
+
+    // Single colors at either end are blended as the first color of a pair.
+    blendA = (blendColor & BLEND_MASK_A) * coeff;
+    blendB = ((blendColor >> 5) & BLEND_MASK_B) * coeff;
+
+    if (numColors != 0 && ((u32)src & 2))
+    {
+        *(dest++) = BlendColorPair(*(src++), blendA, blendB, 16 - coeff);
+        numColors--;
     }
+
+    BlendColorPairs((const u32 *)src, (u32 *)dest, numColors / 2, coeff, blendColor);
+
+    if (numColors & 1)
+    {
+        i = numColors - 1;
+        dest[i] = BlendColorPair(src[i], blendA, blendB, 16 - coeff);
+    }
+}
+
+void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u16 blendColor)
+{
+    BlendColors(&gPlttBufferUnfaded[palOffset], &gPlttBufferFaded[palOffset], numEntries, coeff, blendColor);
+    MarkPaletteRangeDirty(palOffset, numEntries);
 }